@@ -20,3 +20,7 @@ if(CMAKE_CROSSCOMPILING)
 else()
   set(MRuby_LIBRARIES "${TSC_BINARY_DIR}/mruby/build/host/lib/libmruby.a" "${TSC_BINARY_DIR}/mruby/build/host/lib/libmruby_core.a")
 endif()
+
+# The bytecode compiler always runs on the build machine, so it is
+# taken from the host build even when cross-compiling.
+set(MRuby_MRBC "${TSC_BINARY_DIR}/mruby/build/host/bin/mrbc")
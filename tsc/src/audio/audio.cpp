@@ -30,12 +30,97 @@ using namespace std;
 namespace fs = boost::filesystem;
 
 namespace TSC {
+/* *** *** *** *** *** *** *** *** Sound handle *** *** *** *** *** *** *** *** *** */
+
+cSound_Handle::cSound_Handle(void)
+{
+    m_priority = SOUND_PRIORITY_NORMAL;
+    m_sound = NULL;
+    m_generation = 0;
+    m_resolved = 0;
+}
+
+cSound_Handle::cSound_Handle(const std::string& filename, SoundPriority priority /* = SOUND_PRIORITY_NORMAL */)
+{
+    m_priority = priority;
+    m_filename = filename;
+    m_sound = NULL;
+    m_generation = 0;
+    m_resolved = 0;
+}
+
+cSound_Handle& cSound_Handle::operator=(const std::string& filename)
+{
+    Set_Filename(filename);
+    return *this;
+}
+
+void cSound_Handle::Set_Filename(const std::string& filename)
+{
+    m_filename = filename;
+    m_sound = NULL;
+    m_resolved = 0;
+}
+
+const std::string& cSound_Handle::Get_Filename(void) const
+{
+    return m_filename;
+}
+
+cSound* cSound_Handle::Get_Sound(void) const
+{
+    // don't remember failures while sound is disabled
+    if (!pAudio->m_initialised || !pAudio->m_sound_enabled || m_filename.empty()) {
+        return NULL;
+    }
+
+    // already looked up
+    if (m_resolved && m_generation == pSound_Manager->Get_Generation()) {
+        return m_sound;
+    }
+
+    m_sound = NULL;
+    m_resolved = 0;
+
+    fs::path filename = utf8_to_path(m_filename);
+
+    // not available
+    if (!File_Exists(filename)) {
+        // add sound directory
+        if (!filename.is_absolute())
+            filename = pPackage_Manager->Get_Sound_Reading_Path(m_filename);
+
+        // not found
+        if (!File_Exists(filename)) {
+            cerr << "Warning: Could not find sound file '" << path_to_utf8(filename) << "'" << endl;
+            return NULL;
+        }
+    }
+
+    m_sound = pAudio->Get_Sound_File(filename);
+
+    // failed loading
+    if (!m_sound) {
+        cerr << "Warning: Could not load sound file '" << path_to_utf8(filename) << "'" << endl;
+        return NULL;
+    }
+
+    // failures are not remembered as the file may become available later
+    m_resolved = 1;
+    m_generation = pSound_Manager->Get_Generation();
+
+    return m_sound;
+}
+
 /* *** *** *** *** *** *** *** *** Audio Sound *** *** *** *** *** *** *** *** *** */
 
 cAudio_Sound::cAudio_Sound(void)
 {
     m_data = NULL;
     m_resource_id = -1;
+    m_priority = SOUND_PRIORITY_NORMAL;
+    m_volume = 0;
+    m_start_time = 0;
 }
 
 cAudio_Sound::~cAudio_Sound(void)
@@ -118,6 +203,9 @@ cAudio::cAudio(void)
 
     m_music = new sf::Music;
     m_music_old = NULL;
+    m_music_fadein = 0;
+
+    m_last_update_ticks = 0;
 
     m_max_sounds = 100; // XXX: what???
 }
@@ -194,6 +282,9 @@ void cAudio::Close(void)
             cout << "Closing Audio System" << endl;
         }
 
+        // faded sources get deleted
+        m_fader.Clear();
+
         if (m_sound_enabled) {
             Stop_Sounds();
 
@@ -265,29 +356,53 @@ bool cAudio::Play_Sound(fs::path filename, int res_id /* = -1 */, int volume /*
         return 0;
     }
 
-    // not available
-    if (!File_Exists(filename)) {
-        // add sound directory
-        if (!filename.is_absolute())
-            filename = pPackage_Manager->Get_Sound_Reading_Path(path_to_utf8(filename));
+    const std::string name = path_to_utf8(filename);
 
-        // not found
-        if (!File_Exists(filename)) {
-            cerr << "Warning: Could not find sound file '" << path_to_utf8(filename) << "'" << endl;
-            return false;
-        }
+    // look up each filename only once
+    Sound_Handle_Map::iterator itr = m_sound_handles.find(name);
+
+    if (itr == m_sound_handles.end()) {
+        itr = m_sound_handles.insert(Sound_Handle_Map::value_type(name, cSound_Handle(name))).first;
     }
 
-    cSound* sound_data = Get_Sound_File(filename);
+    cSound* sound_data = itr->second.Get_Sound();
 
-    // failed loading
     if (!sound_data) {
-        cerr << "Warning: Could not load sound file '" << path_to_utf8(filename) << "'" << endl;
-        return false;
+        return 0;
+    }
+
+    return Play_Sound_Data(sound_data, res_id, volume, loops, res_id >= 0 ? SOUND_PRIORITY_HIGH : SOUND_PRIORITY_NORMAL);
+}
+
+bool cAudio::Play_Sound(const cSound_Handle& handle, int res_id /* = -1 */, int volume /* = -1 */, bool loops /* = false */)
+{
+    if (!m_initialised || !m_sound_enabled) {
+        return 0;
+    }
+
+    cSound* sound_data = handle.Get_Sound();
+
+    if (!sound_data) {
+        return 0;
+    }
+
+    return Play_Sound_Data(sound_data, res_id, volume, loops, handle.m_priority);
+}
+
+bool cAudio::Play_Sound_Data(cSound* sound_data, int res_id, int volume, bool loops, SoundPriority priority)
+{
+    // volume is out of range
+    if (volume > MAX_VOLUME) {
+        cerr << "PlaySound Volume is out of range : " << volume << endl;
+        volume = m_sound_volume;
+    }
+    // no volume is given
+    else if (volume < 0) {
+        volume = m_sound_volume;
     }
 
     // create channel
-    cAudio_Sound* sound = Create_Sound_Channel();
+    cAudio_Sound* sound = Create_Sound_Channel(priority);
 
     if (!sound) {
         // no free channel available
@@ -296,27 +411,19 @@ bool cAudio::Play_Sound(fs::path filename, int res_id /* = -1 */, int volume /*
 
     // load data
     sound->Load(sound_data);
+    sound->m_priority = priority;
+    sound->m_volume = volume;
+    sound->m_start_time = TSC_GetTicks();
+
+    // set volume
+    m_fader.Remove(sound->m_sound);
+    sound->m_sound.setVolume(volume);
 
     // failed to play
     if (!sound->Play(res_id, loops)) {
-        debug_print("Could not play sound file : %s\n", path_to_utf8(filename).c_str());
+        debug_print("Could not play sound file : %s\n", path_to_utf8(sound_data->m_filename).c_str());
         return 0;
     }
-    // playing successfully
-    else {
-        // volume is out of range
-        if (volume > MAX_VOLUME) {
-            cerr << "PlaySound Volume is out of range : " << volume << endl;
-            volume = m_sound_volume;
-        }
-        // no volume is given
-        else if (volume < 0) {
-            volume = m_sound_volume;
-        }
-
-        // set volume
-        sound->m_sound.setVolume(volume);
-    }
 
     return 1;
 }
@@ -344,15 +451,30 @@ bool cAudio::Play_Music(fs::path filename, bool loops /* = false */, bool force
 
     // if no music is playing or force to play the given music
     if (!Is_Music_Playing() || force) {
-        // stop current music
-        Halt_Music();
+        // cross fade the playing music
+        bool crossfade = fadein_ms && m_music->getStatus() == sf::SoundSource::Playing;
 
         // free old music
         if (m_music_old) {
+            m_fader.Remove(*m_music_old);
+            m_music_old->stop();
             delete m_music_old;
             m_music_old = NULL;
         }
 
+        if (crossfade) {
+            m_music_old = m_music;
+            m_music = new sf::Music;
+            m_fader.Fade(*m_music_old, 0.0f, fadein_ms, 1);
+        }
+        // stop current music
+        else {
+            m_fader.Remove(*m_music);
+            m_music->stop();
+        }
+
+        m_music_fadein = 0;
+
         // load the given music
         if (!m_music->openFromFile(path_to_utf8(filename).c_str())) {
             debug_print("Couldn't load music file : %s\n", path_to_utf8(filename).c_str());
@@ -364,21 +486,14 @@ bool cAudio::Play_Music(fs::path filename, bool loops /* = false */, bool force
         m_music->setLoop(loops);
         // no fade in
         if (!fadein_ms) {
+            m_music->setVolume(m_music_volume);
             m_music->play();
         }
         // fade in
         else {
-            float current = m_music->getVolume();
-            float count = fadein_ms / m_music->getVolume();
-            m_music->setVolume(count);
+            m_music->setVolume(0.0f);
             m_music->play();
-            while (m_music->getVolume() < current) {
-                // sleep for several milliseconds
-                boost::this_thread::sleep_for(boost::chrono::milliseconds(int(fadein_ms / count)));
-                // raise the volume
-                m_music->setVolume(int(m_music->getVolume()+count));
-            }
-            m_music->setVolume(current);
+            m_fader.Fade(*m_music, m_music_volume, fadein_ms);
         }
     }
     // music is playing and is not forced
@@ -388,6 +503,11 @@ bool cAudio::Play_Music(fs::path filename, bool loops /* = false */, bool force
             m_music_old = m_music;
             m_music = new sf::Music;
         }
+        // replace the queued music
+        else {
+            m_fader.Remove(*m_music);
+            m_music->stop();
+        }
 
         // load the wanted next playing music
         if (!m_music->openFromFile(path_to_utf8(filename).c_str())) {
@@ -396,6 +516,11 @@ bool cAudio::Play_Music(fs::path filename, bool loops /* = false */, bool force
             // failed to play
             return false;
         }
+
+        // started in Update()
+        m_music->setLoop(loops);
+        m_music->setVolume(m_music_volume);
+        m_music_fadein = fadein_ms;
     }
 
     return true;
@@ -432,8 +557,36 @@ cAudio_Sound* cAudio::Get_Playing_Sound(fs::path filename)
     return NULL;
 }
 
-cAudio_Sound* cAudio::Create_Sound_Channel(void)
+cAudio_Sound* cAudio::Get_Playing_Sound(const cSound_Handle& handle)
 {
+    if (!m_sound_enabled || !m_initialised) {
+        return NULL;
+    }
+
+    cSound* sound_data = handle.Get_Sound();
+
+    if (!sound_data) {
+        return NULL;
+    }
+
+    for (AudioSoundList::const_iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr) {
+        cAudio_Sound* obj = (*itr);
+
+        // found it
+        if (obj->m_data == sound_data && obj->m_sound.getStatus() == sf::SoundSource::Playing) {
+            return obj;
+        }
+    }
+
+    // not found
+    return NULL;
+}
+
+cAudio_Sound* cAudio::Create_Sound_Channel(SoundPriority priority /* = SOUND_PRIORITY_NORMAL */)
+{
+    // channel to steal
+    cAudio_Sound* steal = NULL;
+
     // get all sounds
     for (AudioSoundList::iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr) {
         // get object pointer
@@ -442,9 +595,17 @@ cAudio_Sound* cAudio::Create_Sound_Channel(void)
         // if not playing
         if (obj->m_sound.getStatus() != sf::SoundSource::Playing) {
             // found a free channel
+            m_fader.Remove(obj->m_sound);
             obj->Free();
             return obj;
         }
+
+        // prefer lower priority, then lower volume, then older sounds
+        if (!steal || obj->m_priority < steal->m_priority ||
+            (obj->m_priority == steal->m_priority && (obj->m_volume < steal->m_volume ||
+            (obj->m_volume == steal->m_volume && obj->m_start_time < steal->m_start_time)))) {
+            steal = obj;
+        }
     }
 
     // if not maximum sounds
@@ -454,6 +615,17 @@ cAudio_Sound* cAudio::Create_Sound_Channel(void)
         return sound;
     }
 
+    // steal a less important sound
+    if (steal && steal->m_priority <= priority) {
+        if (m_debug) {
+            cout << "Stopping sound for a new one : " << path_to_utf8(steal->m_data->m_filename) << endl;
+        }
+
+        m_fader.Remove(steal->m_sound);
+        steal->Free();
+        return steal;
+    }
+
     // none found
     return NULL;
 }
@@ -501,18 +673,6 @@ void cAudio::Resume_Music(void)
     }
 }
 
-void cAudio::Fadeout_Source(sf::SoundSource& source, unsigned int ms) {
-    // count is the amount to decrease the sound by
-    float count = ms / source.getVolume();
-    while (source.getVolume() > count) {
-        // sleep for several milliseconds
-        boost::this_thread::sleep_for(boost::chrono::milliseconds(int(ms / count)));
-        // lower the volume
-        source.setVolume(int(source.getVolume()-count));
-    }
-    source.setVolume(0);
-}
-
 void cAudio::Fadeout_Sounds(unsigned int ms /* = 200 */)
 {
     if (!m_sound_enabled || !m_initialised) {
@@ -529,8 +689,13 @@ void cAudio::Fadeout_Sounds(unsigned int ms /* = 200 */)
         // get object pointer
         cAudio_Sound* obj = (*itr);
 
-        // fade the sound
-        Fadeout_Source(obj->m_sound, ms);
+        // not playing
+        if (obj->m_sound.getStatus() != sf::SoundSource::Playing) {
+            continue;
+        }
+
+        // fade the sound and stop it
+        m_fader.Fade(obj->m_sound, 0.0f, ms, 1);
     }
 }
 
@@ -554,8 +719,13 @@ void cAudio::Fadeout_Sounds(unsigned int ms, fs::path filename)
             continue;
         }
 
-        // fade the sound
-        Fadeout_Source(obj->m_sound, ms);
+        // not playing
+        if (obj->m_sound.getStatus() != sf::SoundSource::Playing) {
+            continue;
+        }
+
+        // fade the sound and stop it
+        m_fader.Fade(obj->m_sound, 0.0f, ms, 1);
     }
 }
 
@@ -570,11 +740,15 @@ void cAudio::Fadeout_Music(unsigned int ms /* = 500 */)
         return;
     }
 
-    float orig = m_music->getVolume();
-    Fadeout_Source(*m_music, ms);
-    Halt_Music();
-    // reset volume after the sound stops
-    m_music->setVolume(orig);
+    // stop and reset the volume when faded out
+    if (m_music->getStatus() == sf::SoundSource::Playing) {
+        m_fader.Fade(*m_music, 0.0f, ms, 1, m_music_volume);
+    }
+
+    // queued music starts afterwards
+    if (m_music_old && m_music_old->getStatus() == sf::SoundSource::Playing) {
+        m_fader.Fade(*m_music_old, 0.0f, ms, 1);
+    }
 }
 
 void cAudio::Set_Music_Position(float position)
@@ -612,8 +786,12 @@ void cAudio::Halt_Music(void)
         return;
     }
 
+    m_fader.Remove(*m_music);
     m_music->stop();
+    m_music->setVolume(m_music_volume);
+
     if (m_music_old) {
+        m_fader.Remove(*m_music_old);
         m_music_old->stop();
     }
 }
@@ -651,6 +829,7 @@ void cAudio::Set_Sound_Volume(uint8_t volume)
 
         // set volume
         obj->m_sound.setVolume(volume);
+        obj->m_volume = volume;
     }
 }
 
@@ -666,26 +845,40 @@ void cAudio::Set_Music_Volume(uint8_t volume)
         volume = MAX_VOLUME;
     }
 
-    m_music->setVolume(volume);
+    // fading music ends with the new volume
+    if (!m_fader.Set_End_Volume(*m_music, volume)) {
+        m_music->setVolume(volume);
+    }
 }
 
 void cAudio::Update(void)
 {
+    const uint32_t ticks = TSC_GetTicks();
+    const uint32_t elapsed = m_last_update_ticks ? ticks - m_last_update_ticks : 0;
+    m_last_update_ticks = ticks;
+
     if (!m_initialised) {
         return;
     }
 
-    // if music is enabled
-    if (m_music_enabled) {
-        // if no music is playing
-        if (!Is_Music_Playing()) {
-            m_music->play();
-            if (m_music_old) {
-                m_music_old->stop();
-                delete m_music_old;
-                m_music_old = NULL;
+    m_fader.Update(elapsed);
+
+    // if music is enabled and the old music finished or faded out
+    if (m_music_enabled && m_music_old && m_music_old->getStatus() == sf::SoundSource::Stopped) {
+        delete m_music_old;
+        m_music_old = NULL;
+
+        // start the queued music if not cross fading
+        if (m_music->getStatus() != sf::SoundSource::Playing) {
+            if (m_music_fadein) {
+                m_music->setVolume(0.0f);
+                m_fader.Fade(*m_music, m_music_volume, m_music_fadein);
             }
+
+            m_music->play();
         }
+
+        m_music_fadein = 0;
     }
 }
 
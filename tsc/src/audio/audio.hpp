@@ -21,6 +21,7 @@
 
 #include "../core/global_basic.hpp"
 #include "../audio/sound_manager.hpp"
+#include "../audio/audio_fader.hpp"
 #include "../scripting/scriptable_object.hpp"
 #include "../scripting/objects/misc/mrb_audio.hpp"
 
@@ -47,6 +48,53 @@ namespace TSC {
         RID_MOON            = 7
     };
 
+    /* Sound priorities
+     * If no channel is free the sound with the lowest priority is stopped
+     * for a new sound with the same or a higher priority.
+    */
+    enum SoundPriority {
+        SOUND_PRIORITY_LOW    = 0, // ambient sounds
+        SOUND_PRIORITY_NORMAL = 1,
+        SOUND_PRIORITY_HIGH   = 2  // player sounds
+    };
+
+    /* *** *** *** *** *** *** *** Sound handle *** *** *** *** *** *** *** *** *** *** */
+
+    /* A sound file which is looked up and loaded only once
+     * The lookup happens on the first use or with Get_Sound() and is only
+     * repeated if it failed or the sound manager deleted sounds. Create handles when
+     * creating objects to play sounds without file system access.
+    */
+    class cSound_Handle {
+    public:
+        cSound_Handle(void);
+        explicit cSound_Handle(const std::string& filename, SoundPriority priority = SOUND_PRIORITY_NORMAL);
+
+        // Set the filename relative to the sounds directory or absolute
+        cSound_Handle& operator=(const std::string& filename);
+        void Set_Filename(const std::string& filename);
+        // Return the filename as set
+        const std::string& Get_Filename(void) const;
+
+        /* Return the sound data and look it up if needed
+         * Returns NULL if not available
+        */
+        cSound* Get_Sound(void) const;
+
+        // channel priority
+        SoundPriority m_priority;
+
+    private:
+        std::string m_filename;
+
+        // looked up sound
+        mutable cSound* m_sound;
+        // sound manager generation of the lookup
+        mutable unsigned int m_generation;
+        // the sound was found
+        mutable bool m_resolved;
+    };
+
     /* *** *** *** *** *** *** *** Audio Sound object *** *** *** *** *** *** *** *** *** *** */
 
 // Callback for a sound finished playing
@@ -79,6 +127,11 @@ namespace TSC {
         sf::Sound m_sound;
         // the last used resource id
         int m_resource_id;
+        // priority and volume of the current sound
+        SoundPriority m_priority;
+        int m_volume;
+        // time the current sound started
+        uint32_t m_start_time;
     };
 
     typedef vector<cAudio_Sound*> AudioSoundList;
@@ -108,19 +161,30 @@ namespace TSC {
          */
         cSound* Get_Sound_File(boost::filesystem::path filename) const;
 
-        // Play the given sound. `filename' should be relative to the sounds/ directory.
+        /* Play the given sound. `filename' should be relative to the sounds/ directory.
+         * The file is looked up only the first time it is played.
+         * Sounds with a resource id get SOUND_PRIORITY_HIGH.
+        */
         bool Play_Sound(boost::filesystem::path filename, int res_id = -1, int volume = -1, bool loops = false);
-        // If no forcing it will be played after the current music
+        // Play the sound of the handle with its priority
+        bool Play_Sound(const cSound_Handle& handle, int res_id = -1, int volume = -1, bool loops = false);
+        /* If no forcing it will be played after the current music
+         * fadein_ms : fade in time, playing music is cross faded if forced
+        */
         bool Play_Music(boost::filesystem::path filename, bool loops = false, bool force = 1, unsigned int fadein_ms = 0);
 
         /* Returns a pointer to the sound if it is active.
          * The returned sound should not be deleted or modified.
          */
         cAudio_Sound* Get_Playing_Sound(boost::filesystem::path filename);
+        cAudio_Sound* Get_Playing_Sound(const cSound_Handle& handle);
 
-        /* Returns true if a free channel for the sound is available
+        /* Returns a free channel for the sound or NULL if none is available
+         * If all channels are used the sound with the lowest priority,
+         * then the lowest volume and then the oldest one is stopped if
+         * its priority is not higher than the given one.
         */
-        cAudio_Sound* Create_Sound_Channel(void);
+        cAudio_Sound* Create_Sound_Channel(SoundPriority priority = SOUND_PRIORITY_NORMAL);
 
         // Toggle Music on/off
         void Toggle_Music(void);
@@ -132,9 +196,8 @@ namespace TSC {
         // Resume Music
         void Resume_Music(void);
 
-        // Fade out the sound source
-        void Fadeout_Source(sf::SoundSource& source, unsigned int ms);
         /* Fade out Sound(s)
+         * All fade functions return immediately and fade in Update().
          * ms : the time to fade out
          * overwrite_fading : overwrite an already existing fade out
         */
@@ -168,7 +231,7 @@ namespace TSC {
         // Set the Music Volume
         void Set_Music_Volume(uint8_t volume);
 
-        // Update
+        // Update the fades and start queued music
         void Update(void);
 
         // is the audio engine initialized
@@ -189,6 +252,13 @@ namespace TSC {
         sf::Music* m_music;
         // if new music should play after the current this is the old data
         sf::Music* m_music_old;
+        // fade in time of the queued music
+        unsigned int m_music_fadein;
+
+        // volume fades of the music and sounds
+        cAudio_Fader m_fader;
+        // time of the last update
+        uint32_t m_last_update_ticks;
 
         // The current sounds pointer array
         AudioSoundList m_active_sounds;
@@ -196,6 +266,14 @@ namespace TSC {
         // maximum sounds allowed at once
         unsigned int m_max_sounds;
 
+        typedef std::unordered_map<std::string, cSound_Handle> Sound_Handle_Map;
+        // handles of the sounds played by filename
+        Sound_Handle_Map m_sound_handles;
+
+    private:
+        // Play the sound data in a free or stolen channel
+        bool Play_Sound_Data(cSound* sound_data, int res_id, int volume, bool loops, SoundPriority priority);
+
         // initialization information
         /* int m_audio_buffer, m_audio_channels; */
     };
@@ -0,0 +1,227 @@
+/***************************************************************************
+ * audio_fader.cpp - volume fading of sound sources
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../audio/audio_fader.hpp"
+#include "../core/global_basic.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cAudio_Fade *** *** *** *** *** *** *** *** *** *** */
+
+cAudio_Fade::cAudio_Fade(sf::Sound* sound, sf::SoundStream* stream, float end_volume, unsigned int duration, bool stop)
+{
+    m_sound = sound;
+    m_stream = stream;
+
+    if (m_sound) {
+        m_source = m_sound;
+    }
+    else {
+        m_source = m_stream;
+    }
+
+    m_start_volume = m_source->getVolume();
+    m_end_volume = end_volume;
+    m_duration = duration;
+    m_elapsed = 0;
+    m_stop = stop;
+    m_reset_volume = -1.0f;
+}
+
+bool cAudio_Fade::Update(unsigned int elapsed_ms)
+{
+    m_elapsed += elapsed_ms;
+
+    if (m_elapsed >= m_duration) {
+        m_elapsed = m_duration;
+        return 1;
+    }
+
+    return 0;
+}
+
+float cAudio_Fade::Get_Volume(void) const
+{
+    if (!m_duration || m_elapsed >= m_duration) {
+        return m_end_volume;
+    }
+
+    return m_start_volume + ((m_end_volume - m_start_volume) * (static_cast<float>(m_elapsed) / static_cast<float>(m_duration)));
+}
+
+sf::SoundSource::Status cAudio_Fade::Get_Status(void) const
+{
+    if (m_sound) {
+        return m_sound->getStatus();
+    }
+
+    return m_stream->getStatus();
+}
+
+void cAudio_Fade::Stop(void) const
+{
+    if (m_sound) {
+        m_sound->stop();
+    }
+    else {
+        m_stream->stop();
+    }
+}
+
+/* *** *** *** *** *** *** *** cAudio_Fader *** *** *** *** *** *** *** *** *** *** */
+
+cAudio_Fader::cAudio_Fader(void)
+{
+    //
+}
+
+cAudio_Fader::~cAudio_Fader(void)
+{
+    //
+}
+
+void cAudio_Fader::Fade(sf::Sound& sound, float volume, unsigned int ms, bool stop /* = 0 */, float reset_volume /* = -1.0f */)
+{
+    cAudio_Fade fade(&sound, NULL, volume, ms, stop);
+    fade.m_reset_volume = reset_volume;
+
+    Add(fade);
+}
+
+void cAudio_Fader::Fade(sf::SoundStream& stream, float volume, unsigned int ms, bool stop /* = 0 */, float reset_volume /* = -1.0f */)
+{
+    cAudio_Fade fade(NULL, &stream, volume, ms, stop);
+    fade.m_reset_volume = reset_volume;
+
+    Add(fade);
+}
+
+bool cAudio_Fader::Set_End_Volume(const sf::SoundSource& source, float volume)
+{
+    for (AudioFadeList::iterator itr = m_fades.begin(); itr != m_fades.end(); ++itr) {
+        cAudio_Fade& fade = (*itr);
+
+        if (fade.m_source != &source) {
+            continue;
+        }
+
+        // a fade out keeps fading out
+        if (fade.m_stop) {
+            if (fade.m_reset_volume >= 0.0f) {
+                fade.m_reset_volume = volume;
+            }
+        }
+        else {
+            fade.m_end_volume = volume;
+        }
+
+        return 1;
+    }
+
+    return 0;
+}
+
+bool cAudio_Fader::Is_Fading(const sf::SoundSource& source) const
+{
+    for (AudioFadeList::const_iterator itr = m_fades.begin(); itr != m_fades.end(); ++itr) {
+        if ((*itr).m_source == &source) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void cAudio_Fader::Remove(const sf::SoundSource& source)
+{
+    for (AudioFadeList::iterator itr = m_fades.begin(); itr != m_fades.end(); ++itr) {
+        if ((*itr).m_source == &source) {
+            m_fades.erase(itr);
+            return;
+        }
+    }
+}
+
+void cAudio_Fader::Clear(void)
+{
+    m_fades.clear();
+}
+
+void cAudio_Fader::Update(unsigned int elapsed_ms)
+{
+    AudioFadeList::iterator itr = m_fades.begin();
+
+    while (itr != m_fades.end()) {
+        cAudio_Fade& fade = (*itr);
+        const sf::SoundSource::Status status = fade.Get_Status();
+
+        // keep the fade until resumed
+        if (status == sf::SoundSource::Paused) {
+            ++itr;
+            continue;
+        }
+
+        // stopped from somewhere else
+        if (status == sf::SoundSource::Stopped) {
+            if (fade.m_reset_volume >= 0.0f) {
+                fade.m_source->setVolume(fade.m_reset_volume);
+            }
+
+            itr = m_fades.erase(itr);
+            continue;
+        }
+
+        if (fade.Update(elapsed_ms)) {
+            Finish(fade);
+            itr = m_fades.erase(itr);
+            continue;
+        }
+
+        fade.m_source->setVolume(fade.Get_Volume());
+        ++itr;
+    }
+}
+
+void cAudio_Fader::Add(const cAudio_Fade& fade)
+{
+    Remove(*fade.m_source);
+
+    // nothing to wait for
+    if (!fade.m_duration) {
+        Finish(fade);
+        return;
+    }
+
+    m_fades.push_back(fade);
+}
+
+void cAudio_Fader::Finish(const cAudio_Fade& fade) const
+{
+    fade.m_source->setVolume(fade.m_end_volume);
+
+    if (fade.m_stop) {
+        fade.Stop();
+
+        if (fade.m_reset_volume >= 0.0f) {
+            fade.m_source->setVolume(fade.m_reset_volume);
+        }
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,112 @@
+/***************************************************************************
+ * audio_fader.hpp - volume fading of sound sources
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_AUDIO_FADER_HPP
+#define TSC_AUDIO_FADER_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cAudio_Fade *** *** *** *** *** *** *** *** *** *** */
+
+    /* A linear volume ramp of one sound source
+     * sf::SoundSource has no public status and stop functions before
+     * SFML 2.5 so the sound or the stream is kept.
+    */
+    class cAudio_Fade {
+    public:
+        cAudio_Fade(sf::Sound* sound, sf::SoundStream* stream, float end_volume, unsigned int duration, bool stop);
+
+        /* Advance the fade by the given time
+         * Returns true if finished
+        */
+        bool Update(unsigned int elapsed_ms);
+        // Return the volume for the current time
+        float Get_Volume(void) const;
+
+        // Return the source status
+        sf::SoundSource::Status Get_Status(void) const;
+        // Stop the source
+        void Stop(void) const;
+
+        // faded source
+        sf::SoundSource* m_source;
+        sf::Sound* m_sound;
+        sf::SoundStream* m_stream;
+        // volume range
+        float m_start_volume;
+        float m_end_volume;
+        // length and elapsed time in milliseconds
+        unsigned int m_duration;
+        unsigned int m_elapsed;
+        // stop the source when finished
+        bool m_stop;
+        // volume to set after stopping or negative if none
+        float m_reset_volume;
+    };
+
+    typedef vector<cAudio_Fade> AudioFadeList;
+
+    /* *** *** *** *** *** *** *** cAudio_Fader *** *** *** *** *** *** *** *** *** *** */
+
+    /* Fades sound sources in the background
+     *
+     * All calls return immediately. The volumes are changed in Update()
+     * which gets the elapsed time passed so it does not depend on the
+     * real clock. Paused sources keep their fade and stopped sources
+     * lose it.
+    */
+    class cAudio_Fader {
+    public:
+        cAudio_Fader(void);
+        ~cAudio_Fader(void);
+
+        /* Fade the source from its current volume to the given volume
+         * An existing fade of the source is replaced.
+         * stop : stop the source when finished
+         * reset_volume : set this volume after stopping (negative if none)
+        */
+        void Fade(sf::Sound& sound, float volume, unsigned int ms, bool stop = 0, float reset_volume = -1.0f);
+        void Fade(sf::SoundStream& stream, float volume, unsigned int ms, bool stop = 0, float reset_volume = -1.0f);
+        /* Change the volume the source has after an active fade
+         * Returns false if the source is not fading
+        */
+        bool Set_End_Volume(const sf::SoundSource& source, float volume);
+        // Return true if the source is fading
+        bool Is_Fading(const sf::SoundSource& source) const;
+        // Remove the fade of the source without changing its volume
+        void Remove(const sf::SoundSource& source);
+        // Remove all fades
+        void Clear(void);
+
+        // Advance all fades by the given time
+        void Update(unsigned int elapsed_ms);
+
+        // active fades
+        AudioFadeList m_fades;
+
+    private:
+        // Replace the fade of the source
+        void Add(const cAudio_Fade& fade);
+        // Set the final state of the fade source
+        void Finish(const cAudio_Fade& fade) const;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -79,7 +79,10 @@ void cRandom_Sound::Init(void)
     m_massive_type = MASS_PASSIVE;
     m_editor_pos_z = 0.111f;
     m_camera_range = 0;
+    // volume depends on the distance
+    m_sleep_policy = SLEEP_NEVER;
     m_name = "Sound";
+    m_sound.m_priority = SOUND_PRIORITY_LOW;
 
     m_rect.m_w = 10.0f;
     m_rect.m_h = 10.0f;
@@ -151,7 +154,7 @@ void cRandom_Sound::Set_Filename(const std::string& str)
 {
     // stop playing sounds
     for (unsigned int i = 0; i < 100; i++) {
-        cAudio_Sound* sound = pAudio->Get_Playing_Sound(m_filename);
+        cAudio_Sound* sound = pAudio->Get_Playing_Sound(m_sound);
 
         if (!sound) {
             break;
@@ -161,6 +164,7 @@ void cRandom_Sound::Set_Filename(const std::string& str)
     }
 
     m_filename = str;
+    m_sound = str;
 }
 
 std::string cRandom_Sound::Get_Filename(void) const
@@ -304,7 +308,7 @@ void cRandom_Sound::Update(void)
         m_volume_update_counter -= pFramerate->m_elapsed_ticks;
 
         // get the sound
-        cAudio_Sound* sound = pAudio->Get_Playing_Sound(m_filename);
+        cAudio_Sound* sound = pAudio->Get_Playing_Sound(m_sound);
 
         // if not playing
         if (!sound) {
@@ -321,6 +325,7 @@ void cRandom_Sound::Update(void)
             sound_volume *= static_cast<float>(MAX_VOLUME);
             // set volume
             sound->m_sound.setVolume(static_cast<uint8_t>(sound_volume));
+            sound->m_volume = static_cast<uint8_t>(sound_volume);
 
             // update volume every 100 ms
             m_volume_update_counter = 100.0f;
@@ -370,7 +375,7 @@ void cRandom_Sound::Update(void)
         sound_volume *= static_cast<float>(MAX_VOLUME);
 
         // play sound
-        pAudio->Play_Sound(m_filename, -1, static_cast<int>(sound_volume), m_continuous);
+        pAudio->Play_Sound(m_sound, -1, static_cast<int>(sound_volume), m_continuous);
     }
 }
 
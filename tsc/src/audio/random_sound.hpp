@@ -19,6 +19,7 @@
 
 #include "../core/global_basic.hpp"
 #include "../objects/sprite.hpp"
+#include "../audio/audio.hpp"
 
 namespace TSC {
 
@@ -118,6 +119,8 @@ namespace TSC {
     private:
         // the audio filename to play
         std::string m_filename;
+        // ambient sounds have a low priority
+        cSound_Handle m_sound;
         // is it played continuous
         bool m_continuous;
         // delay in milliseconds
@@ -54,6 +54,7 @@ cSound_Manager::cSound_Manager(void)
     : cObject_Manager<cSound>()
 {
     m_load_count = 0;
+    m_generation = 0;
 }
 
 cSound_Manager::~cSound_Manager(void)
@@ -63,23 +64,45 @@ cSound_Manager::~cSound_Manager(void)
 
 cSound* cSound_Manager::Get_Pointer(const fs::path& path) const
 {
-    for (SoundList::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        cSound* obj = (*itr);
+    Sound_Path_Map::const_iterator itr = m_index.find(path.string());
 
-        if (obj->m_filename.compare(path) == 0) {
-            // return first found
-            return obj;
-        }
+    // not found
+    if (itr == m_index.end()) {
+        return NULL;
     }
 
-    // not found
-    return NULL;
+    return itr->second;
 }
 
 void cSound_Manager::Add(cSound* sound)
 {
     m_load_count++;
     cObject_Manager<cSound>::Add(sound);
+    // keep the first sound if the path is used more than once
+    m_index.insert(Sound_Path_Map::value_type(sound->m_filename.string(), sound));
+}
+
+bool cSound_Manager::Delete(size_t array_num, bool delete_data /* = 1 */)
+{
+    bool result = cObject_Manager<cSound>::Delete(array_num, delete_data);
+    Update_Index();
+    m_generation++;
+    return result;
+}
+
+bool cSound_Manager::Delete(cSound* sound, bool delete_data /* = 1 */)
+{
+    bool result = cObject_Manager<cSound>::Delete(sound, delete_data);
+    Update_Index();
+    m_generation++;
+    return result;
+}
+
+void cSound_Manager::Delete_All(void)
+{
+    cObject_Manager<cSound>::Delete_All();
+    m_index.clear();
+    m_generation++;
 }
 
 void cSound_Manager::Delete_Sounds(void)
@@ -90,6 +113,25 @@ void cSound_Manager::Delete_Sounds(void)
         delete obj;
         obj = NULL;
     }
+
+    m_index.clear();
+    m_generation++;
+}
+
+unsigned int cSound_Manager::Get_Generation(void) const
+{
+    return m_generation;
+}
+
+void cSound_Manager::Update_Index(void)
+{
+    m_index.clear();
+
+    for (SoundList::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSound* obj = (*itr);
+
+        m_index.insert(Sound_Path_Map::value_type(obj->m_filename.string(), obj));
+    }
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
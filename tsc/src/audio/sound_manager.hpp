@@ -61,7 +61,13 @@ namespace TSC {
         /* Add a Sound
          * Should always have the path set
          */
-        void Add(cSound* item);
+        virtual void Add(cSound* item);
+        // Delete the sound from given array number
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        // Delete the given sound
+        virtual bool Delete(cSound* item, bool delete_data = 1);
+        // Delete all sounds
+        virtual void Delete_All(void);
 
         cSound* operator [](unsigned int identifier) const
         {
@@ -76,9 +82,23 @@ namespace TSC {
         // Delete all Sounds, but keep object vector entries
         void Delete_Sounds(void);
 
+        /* Return the number of times sounds were deleted
+         * Sound handles resolve their sound again if this changed.
+        */
+        unsigned int Get_Generation(void) const;
+
     private:
+        // Rebuild the path index
+        void Update_Index(void);
+
         // sounds loaded since initialization
         unsigned int m_load_count;
+        // changed when sounds get deleted
+        unsigned int m_generation;
+
+        typedef std::unordered_map<std::string, cSound*> Sound_Path_Map;
+        // sounds by path
+        Sound_Path_Map m_index;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -0,0 +1,130 @@
+/***************************************************************************
+ * alloc_tracker.cpp - global heap allocation counter
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/alloc_tracker.hpp"
+#include "../core/global_basic.hpp"
+
+#ifdef ENABLE_ALLOCATION_TRACKER
+
+#include <atomic>
+#include <new>
+
+/* The counters are updated from the worker threads as well, so they
+ * have to be atomic. They are constant initialized and thus usable
+ * before any static constructor ran.
+ */
+static std::atomic<uint64_t> g_allocation_count(0);
+static std::atomic<uint64_t> g_allocated_bytes(0);
+
+static void* Tracked_Allocation(std::size_t size)
+{
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+    // malloc may return NULL for a size of 0
+    if (size == 0) {
+        size = 1;
+    }
+
+    return malloc(size);
+}
+
+static void* Tracked_Allocation_Or_Throw(std::size_t size)
+{
+    void* ptr = Tracked_Allocation(size);
+
+    while (!ptr) {
+        std::new_handler handler = std::get_new_handler();
+
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+
+        handler();
+        ptr = malloc(size ? size : 1);
+    }
+
+    return ptr;
+}
+
+/* *** *** *** *** *** *** *** global operator new/delete *** *** *** *** *** *** *** *** *** *** */
+
+void* operator new(std::size_t size)
+{
+    return Tracked_Allocation_Or_Throw(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return Tracked_Allocation_Or_Throw(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Tracked_Allocation(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Tracked_Allocation(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    free(ptr);
+}
+
+#endif
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** Allocation tracker *** *** *** *** *** *** *** *** *** *** */
+
+uint64_t Get_Allocation_Count(void)
+{
+#ifdef ENABLE_ALLOCATION_TRACKER
+    return g_allocation_count.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+uint64_t Get_Allocated_Bytes(void)
+{
+#ifdef ENABLE_ALLOCATION_TRACKER
+    return g_allocated_bytes.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
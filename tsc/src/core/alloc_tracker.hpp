@@ -0,0 +1,41 @@
+/***************************************************************************
+ * alloc_tracker.hpp - global heap allocation counter
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_ALLOC_TRACKER_HPP
+#define TSC_ALLOC_TRACKER_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** Allocation tracker *** *** *** *** *** *** *** *** *** *** */
+
+    /* If built with ENABLE_ALLOCATION_TRACKER the global operator new
+     * counts every heap allocation of the process. The counters only
+     * ever grow, take the difference of two readings to get the
+     * allocations in between.
+     * Without the option both functions always return 0.
+    */
+
+    // amount of allocations since the program start
+    uint64_t Get_Allocation_Count(void);
+    // allocated bytes since the program start
+    uint64_t Get_Allocated_Bytes(void);
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
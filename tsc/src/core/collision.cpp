@@ -106,6 +106,35 @@ cObjectCollision* cObjectCollisionType::Find_First(const SpriteType type)
 
 /* *** *** *** *** *** *** *** cObjectCollision *** *** *** *** *** *** *** *** *** *** */
 
+// memory of deleted collisions for reuse
+static std::vector<void*> g_collision_free_list;
+
+void* cObjectCollision::operator new(size_t size)
+{
+    if (size != sizeof(cObjectCollision) || g_collision_free_list.empty()) {
+        return ::operator new(size);
+    }
+
+    void* ptr = g_collision_free_list.back();
+    g_collision_free_list.pop_back();
+
+    return ptr;
+}
+
+void cObjectCollision::operator delete(void* ptr, size_t size)
+{
+    if (!ptr) {
+        return;
+    }
+
+    if (size != sizeof(cObjectCollision)) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    g_collision_free_list.push_back(ptr);
+}
+
 cObjectCollision::cObjectCollision(void)
 {
     m_valid_type = COL_VTYPE_NOT_VALID;
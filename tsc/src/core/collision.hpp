@@ -35,6 +35,13 @@ namespace TSC {
         cObjectCollision(void);
         ~cObjectCollision(void);
 
+        /* Allocate from the memory of deleted collisions
+         * collisions are created and deleted many times each frame
+         * only use from the main thread
+        */
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         /* Set the collision direction
          * base - the base sprite
          * col - the colliding sprite
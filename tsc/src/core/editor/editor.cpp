@@ -110,6 +110,16 @@ void cEditor::Unload(void)
     for(iter=m_menu_entries.begin(); iter != m_menu_entries.end(); iter++)
         delete *iter;
 
+    m_menu_entries.clear();
+
+    // The special item sprites are owned by the sprite manager
+    EditorCatalogItemList::iterator item_iter;
+    for(item_iter=m_special_items.begin(); item_iter != m_special_items.end(); item_iter++)
+        delete *item_iter;
+
+    m_special_items.clear();
+    m_catalog.Clear();
+
     if (mp_editor_root) {
         CEGUI::System::getSingleton().getDefaultGUIContext().getRootWindow()->removeChild(mp_editor_root);
         CEGUI::WindowManager::getSingleton().destroyWindow(mp_editor_root); // destroys child windows
@@ -743,27 +753,26 @@ bool cEditor::Mouse_Move(const sf::Event& evt)
 
 /**
  * Adds a graphic for a static .settings-file based object to the
- * editor menu. The settings file of this graphic will be parsed and
- * it will be placed in the menu accordingly (subclasses have to set
+ * editor menu. The catalog item holds the settings of the graphic
+ * and it will be placed in the menu accordingly (subclasses have to set
  * the `m_editor_item_tag` member variable the the master tag required
  * for graphics to show up in this editor; these are "level" and
  * "world" for the level and world editor subclasses,
  * respectively. That is, a graphic tagged with "world" will never
  * appear in the level editor, and vice-versa.).
  *
- * \param settings_path
- * Absolute path that refers to the settings file
- * of the graphic to add.
+ * The image is not loaded until a menu entry containing it is
+ * activated, see load_pending_items().
+ *
+ * \param p_item
+ * Catalog item of the graphic to add.
  *
  * \returns false if the item was not added because the master tag
  * was missing, true otherwise.
  */
-bool cEditor::Try_Add_Image_Item(boost::filesystem::path settings_path)
+bool cEditor::Try_Add_Image_Item(cEditor_Catalog_Item* p_item)
 {
-    // Parse the image's settings file
-    cImage_Settings_Parser parser;
-    cImage_Settings_Data* p_settings = parser.Get(settings_path);
-    std::vector<std::string> available_tags = string_split(p_settings->m_editor_tags, ";");
+    std::vector<std::string> available_tags = string_split(p_item->m_editor_tags, ";");
 
     // If the master tag is not in the tag list, do not add this graphic to the
     // editor.
@@ -774,51 +783,11 @@ bool cEditor::Try_Add_Image_Item(boost::filesystem::path settings_path)
     std::vector<cEditor_Menu_Entry*> target_menu_entries = find_target_menu_entries_for(available_tags);
     std::vector<cEditor_Menu_Entry*>::iterator iter;
 
-    // Find the PNG of this settings file. If an equally named .png exists,
-    // assume that file, otherwise check the settings 'base' property. If
-    // that also doesn't exist, that's an error.
-    boost::filesystem::path pixmap_path(settings_path); // Copy
-    pixmap_path.replace_extension(utf8_to_path(".png"));
-    if (!boost::filesystem::exists(pixmap_path)) {
-        if (p_settings->m_base.empty()) { // Error
-            std::cerr << "PNG file for settings file '" << path_to_utf8(settings_path) << "' not found (no .png found and no 'base' setting)." << std::endl;
-            std::cerr << "Using dummy image instead." << std::endl;
-            pixmap_path = pResource_Manager->Get_Game_Pixmap("game/image_not_found.png");
-        }
-        else {
-            pixmap_path = pixmap_path.parent_path() / p_settings->m_base;
-            if (!boost::filesystem::exists(pixmap_path)) {
-                std::cerr << "PNG base file not found at '" << path_to_utf8(pixmap_path) << "'." << std::endl;
-                std::cerr << "Using dummy image instead." << std::endl;
-                pixmap_path = pResource_Manager->Get_Game_Pixmap("game/image_not_found.png");
-            }
-        }
-    }
-
-    // Create the template sprite that will be copied each time the
-    // user wants to add this object.
-    // Cf. cSprite::cSprite(XmlAtributes) constructor on how to create
-    // a sprite correctly.
-    cSprite* p_template_sprite = new cSprite(&m_sprite_manager);
-    p_template_sprite->Set_Image(pVideo->Get_Surface(settings_path), 1); // FIXME: handle .imgset files?
-    p_template_sprite->Set_Massive_Type(p_settings->m_massive_type);
-    m_sprite_manager.Add(p_template_sprite); // Memory-manage it
-
-    // Add the graphics to the respective menu entries' GUI panels.
+    // Add the graphics to the respective menu entries when shown.
     for(iter=target_menu_entries.begin(); iter != target_menu_entries.end(); iter++) {
-        (*iter)->Add_Item(
-            p_template_sprite,
-            load_cegui_image(pixmap_path),
-            p_settings->m_name,
-            CEGUI::Quaternion::eulerAnglesDegrees(
-                p_settings->m_rotation_x,
-                p_settings->m_rotation_y,
-                p_settings->m_rotation_z
-                )
-            );
+        (*iter)->Add_Pending_Item(p_item);
     }
 
-    delete p_settings;
     return true;
 }
 
@@ -846,24 +815,23 @@ bool cEditor::Try_Add_Special_Item(cSprite* p_sprite)
 
     // Some objects (like pathes) have no image at all. For those we can directly
     // jump to the dummy image.
-    boost::filesystem::path image_path;
+    cEditor_Catalog_Item* p_item = new cEditor_Catalog_Item();
     if (p_sprite->Get_Image(0))
-        image_path = p_sprite->Get_Image(0)->Get_Real_PNG_Path();
+        p_item->m_pixmap_path = p_sprite->Get_Image(0)->Get_Real_PNG_Path();
     else
-        image_path = pResource_Manager->Get_Game_Pixmap("game/image_not_found.png");
+        p_item->m_pixmap_path = pResource_Manager->Get_Game_Pixmap("game/image_not_found.png");
+
+    p_item->m_name = p_sprite->Create_Name();
+    p_item->m_editor_tags = p_sprite->m_editor_tags;
+    p_item->m_rotation_x = p_sprite->m_start_rot_x;
+    p_item->m_rotation_y = p_sprite->m_start_rot_y;
+    p_item->m_rotation_z = p_sprite->m_start_rot_z;
+    p_item->mp_template_sprite = p_sprite;
+    m_special_items.push_back(p_item);
 
-    // Add the graphics to the respective menu entries' GUI panels.
+    // Add the graphics to the respective menu entries when shown.
     for(iter=target_menu_entries.begin(); iter != target_menu_entries.end(); iter++) {
-        (*iter)->Add_Item(
-            p_sprite,
-            load_cegui_image(image_path),
-            p_sprite->Create_Name(),
-            CEGUI::Quaternion::eulerAnglesDegrees(
-                p_sprite->m_start_rot_x,
-                p_sprite->m_start_rot_y,
-                p_sprite->m_start_rot_z
-                )
-            );
+        (*iter)->Add_Pending_Item(p_item);
     }
 
     return true;
@@ -930,12 +898,14 @@ void cEditor::populate_menu()
 }
 
 /// Load the static .settings-file based objects into the editor menu.
+/// Only the settings files changed since the last run are parsed.
 void cEditor::load_image_items()
 {
-    std::vector<boost::filesystem::path> image_files = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory(), ".settings");
-    std::vector<boost::filesystem::path>::iterator iter;
+    m_catalog.Update(pResource_Manager->Get_Game_Pixmaps_Directory(), pResource_Manager->Get_User_Imgcache_Directory() / utf8_to_path("editor_catalog.txt"));
+
+    EditorCatalogItemList::iterator iter;
 
-    for(iter=image_files.begin(); iter != image_files.end(); iter++) {
+    for(iter=m_catalog.m_items.begin(); iter != m_catalog.m_items.end(); iter++) {
         Try_Add_Image_Item(*iter);
     }
 }
@@ -951,6 +921,45 @@ void cEditor::load_special_items()
     }
 }
 
+/**
+ * Adds the items of the menu entry to its GUI panel. The images and
+ * template sprites of the items are loaded here so only the browsed
+ * menu entries cost time and memory.
+ */
+void cEditor::load_pending_items(cEditor_Menu_Entry* p_menu_entry)
+{
+    EditorCatalogItemList& items = p_menu_entry->Get_Pending_Items();
+    EditorCatalogItemList::iterator iter;
+
+    for(iter=items.begin(); iter != items.end(); iter++) {
+        cEditor_Catalog_Item* p_item = *iter;
+
+        // Create the template sprite that will be copied each time the
+        // user wants to add this object. It is shared by all menu entries.
+        // Cf. cSprite::cSprite(XmlAtributes) constructor on how to create
+        // a sprite correctly.
+        if (!p_item->mp_template_sprite) {
+            p_item->mp_template_sprite = new cSprite(&m_sprite_manager);
+            p_item->mp_template_sprite->Set_Image(pVideo->Get_Surface(p_item->m_settings_path), 1); // FIXME: handle .imgset files?
+            p_item->mp_template_sprite->Set_Massive_Type(p_item->m_massive_type);
+            m_sprite_manager.Add(p_item->mp_template_sprite); // Memory-manage it
+        }
+
+        p_menu_entry->Add_Item(
+            p_item->mp_template_sprite,
+            load_cegui_image(p_item->m_pixmap_path),
+            p_item->m_name,
+            CEGUI::Quaternion::eulerAnglesDegrees(
+                p_item->m_rotation_x,
+                p_item->m_rotation_y,
+                p_item->m_rotation_z
+                )
+            );
+    }
+
+    items.clear();
+}
+
 cEditor_Menu_Entry* cEditor::get_menu_entry(const std::string& name)
 {
     std::vector<cEditor_Menu_Entry*>::iterator iter;
@@ -1043,6 +1052,7 @@ bool cEditor::on_menu_selection_changed(const CEGUI::EventArgs& event)
     }
 
     // Ordinary menu item (i.e. submenu with game objects).
+    load_pending_items(p_menu_entry);
     p_menu_entry->Activate(mp_editor_tabpane);
 
     return true;
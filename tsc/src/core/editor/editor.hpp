@@ -18,6 +18,8 @@
 #define TSC_EDITOR_HPP
 #ifdef ENABLE_EDITOR
 
+#include "editor_catalog.hpp"
+
 namespace TSC {
     class cEditor_Menu_Entry {
     public:
@@ -25,6 +27,9 @@ namespace TSC {
         ~cEditor_Menu_Entry();
 
         void Add_Item(cSprite* p_template_sprite, std::string cegui_img_ident, std::string name, CEGUI::Quaternion rotation); // FIXME: Must take std::vector<cSprite*> due to multi-sprite objects
+        // Add an item which is shown with Add_Item() when first activated
+        inline void Add_Pending_Item(cEditor_Catalog_Item* p_item) { m_pending_items.push_back(p_item); }
+        inline EditorCatalogItemList& Get_Pending_Items() { return m_pending_items; }
         void Activate(CEGUI::TabControl* p_tabcontrol);
 
         inline void Set_Color(Color color){ m_color = color; }
@@ -48,6 +53,7 @@ namespace TSC {
         bool m_is_header;
         bool m_is_function;
         std::vector<std::string> m_required_tags;
+        EditorCatalogItemList m_pending_items;
         CEGUI::ScrollablePane* mp_tab_pane;
         int m_element_y;
 
@@ -79,7 +85,7 @@ namespace TSC {
         /// Is the config panel shown to the user?
         inline bool Is_Config_Panel_Shown(){ return m_object_config_pane_shown; }
 
-        bool Try_Add_Image_Item(boost::filesystem::path settings_path);
+        bool Try_Add_Image_Item(cEditor_Catalog_Item* p_item);
         bool Try_Add_Special_Item(cSprite* p_sprite); // FIXME: Must take std::vector<cSprite*> due to multi-sprite objects
         void Select_Same_Object_Types(const cSprite* obj);
 
@@ -135,6 +141,10 @@ namespace TSC {
         bool m_mouse_inside;
         std::vector<CEGUI::Window*> m_editor_items;
         std::vector<cEditor_Menu_Entry*> m_menu_entries;
+        // image items from the .settings files
+        cEditor_Catalog m_catalog;
+        // items from the editor items file
+        EditorCatalogItemList m_special_items;
         bool m_help_window_visible;
         bool m_object_config_pane_shown;
         const int CAMERA_SPEED = 35;
@@ -143,6 +153,7 @@ namespace TSC {
         void populate_menu();
         void load_image_items();
         void load_special_items();
+        void load_pending_items(cEditor_Menu_Entry* p_menu_entry);
         cEditor_Menu_Entry* get_menu_entry(const std::string& name);
         std::vector<cEditor_Menu_Entry*> find_target_menu_entries_for(const std::vector<std::string>& available_tags);
         cSprite_List copy_direction(const cSprite_List& objects, const ObjectDirection dir) const;
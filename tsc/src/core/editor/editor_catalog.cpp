@@ -0,0 +1,235 @@
+/***************************************************************************
+ * editor_catalog.cpp - cached list of the editor image items
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "editor_catalog.hpp"
+#include "../filesystem/filesystem.hpp"
+#include "../filesystem/resource_manager.hpp"
+#include "../property_helper.hpp"
+#include "../../video/img_settings.hpp"
+
+#ifdef ENABLE_EDITOR
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cEditor_Catalog_Item *** *** *** *** *** *** *** *** *** *** */
+
+cEditor_Catalog_Item::cEditor_Catalog_Item(void)
+{
+    m_settings_time = 0;
+    m_pixmap_time = 0;
+    m_massive_type = MASS_PASSIVE;
+    m_rotation_x = 0.0f;
+    m_rotation_y = 0.0f;
+    m_rotation_z = 0.0f;
+    mp_template_sprite = NULL;
+}
+
+/* *** *** *** *** *** *** *** cEditor_Catalog *** *** *** *** *** *** *** *** *** *** */
+
+const int cEditor_Catalog::m_file_version = 1;
+
+cEditor_Catalog::cEditor_Catalog(void)
+{
+    //
+}
+
+cEditor_Catalog::~cEditor_Catalog(void)
+{
+    Clear();
+}
+
+void cEditor_Catalog::Update(const fs::path& dir, const fs::path& filename)
+{
+    Clear();
+
+    std::map<std::string, cEditor_Catalog_Item*> cached_items;
+    Load(filename, cached_items);
+
+    vector<fs::path> settings_files = Get_Directory_Files(dir, ".settings");
+    bool changed = cached_items.size() != settings_files.size();
+
+    for (vector<fs::path>::const_iterator itr = settings_files.begin(); itr != settings_files.end(); ++itr) {
+        cEditor_Catalog_Item* item = NULL;
+        std::map<std::string, cEditor_Catalog_Item*>::iterator cached = cached_items.find(path_to_utf8(*itr));
+
+        if (cached != cached_items.end()) {
+            item = cached->second;
+            cached_items.erase(cached);
+
+            // changed
+            if (item->m_settings_time != Get_File_Time(item->m_settings_path) || item->m_pixmap_time != Get_File_Time(item->m_pixmap_path)) {
+                Parse_Settings(item);
+                changed = 1;
+            }
+        }
+        // new
+        else {
+            item = new cEditor_Catalog_Item();
+            item->m_settings_path = *itr;
+            Parse_Settings(item);
+            changed = 1;
+        }
+
+        m_items.push_back(item);
+    }
+
+    // removed settings files
+    for (std::map<std::string, cEditor_Catalog_Item*>::iterator itr = cached_items.begin(); itr != cached_items.end(); ++itr) {
+        delete itr->second;
+    }
+
+    if (changed) {
+        Save(filename);
+    }
+}
+
+void cEditor_Catalog::Clear(void)
+{
+    for (EditorCatalogItemList::iterator itr = m_items.begin(); itr != m_items.end(); ++itr) {
+        delete *itr;
+    }
+
+    m_items.clear();
+}
+
+void cEditor_Catalog::Load(const fs::path& filename, std::map<std::string, cEditor_Catalog_Item*>& items) const
+{
+    fs::ifstream file(filename);
+
+    if (!file) {
+        return;
+    }
+
+    std::string line;
+
+    // unknown format is rebuilt
+    if (!std::getline(file, line) || line != int_to_string(m_file_version)) {
+        return;
+    }
+
+    // settings path, settings time, image path, image time, massive type, rotation x, y, z, editor tags, name
+    while (std::getline(file, line)) {
+        vector<std::string> parts = string_split(line, "\t");
+
+        if (parts.size() != 10) {
+            continue;
+        }
+
+        cEditor_Catalog_Item* item = new cEditor_Catalog_Item();
+        item->m_settings_path = utf8_to_path(parts[0]);
+        item->m_settings_time = string_to_int64(parts[1]);
+        item->m_pixmap_path = utf8_to_path(parts[2]);
+        item->m_pixmap_time = string_to_int64(parts[3]);
+        item->m_massive_type = static_cast<MassiveType>(string_to_int(parts[4]));
+        item->m_rotation_x = string_to_float(parts[5]);
+        item->m_rotation_y = string_to_float(parts[6]);
+        item->m_rotation_z = string_to_float(parts[7]);
+        item->m_editor_tags = parts[8];
+        item->m_name = parts[9];
+
+        // duplicate
+        if (!items.insert(std::make_pair(parts[0], item)).second) {
+            delete item;
+        }
+    }
+}
+
+void cEditor_Catalog::Save(const fs::path& filename) const
+{
+    // write to a temporary file first to never leave a partial catalog
+    fs::path temp_filename = filename;
+    temp_filename.replace_extension(".tmp");
+
+    {
+        fs::ofstream file(temp_filename, ios::out | ios::trunc);
+
+        if (!file) {
+            cerr << "Warning : Could not write editor catalog " << path_to_utf8(temp_filename) << endl;
+            return;
+        }
+
+        file << m_file_version << "\n";
+
+        for (EditorCatalogItemList::const_iterator itr = m_items.begin(); itr != m_items.end(); ++itr) {
+            const cEditor_Catalog_Item* item = (*itr);
+
+            // names are single line texts
+            std::string name = item->m_name;
+            std::replace(name.begin(), name.end(), '\t', ' ');
+            std::replace(name.begin(), name.end(), '\n', ' ');
+
+            file << path_to_utf8(item->m_settings_path) << "\t" << int64_to_string(item->m_settings_time) << "\t";
+            file << path_to_utf8(item->m_pixmap_path) << "\t" << int64_to_string(item->m_pixmap_time) << "\t";
+            file << item->m_massive_type << "\t" << item->m_rotation_x << "\t" << item->m_rotation_y << "\t" << item->m_rotation_z << "\t";
+            file << item->m_editor_tags << "\t" << name << "\n";
+        }
+    }
+
+    boost::system::error_code ec;
+    fs::rename(temp_filename, filename, ec);
+
+    if (ec) {
+        cerr << "Warning : Could not write editor catalog " << path_to_utf8(filename) << " : " << ec.message() << endl;
+    }
+}
+
+void cEditor_Catalog::Parse_Settings(cEditor_Catalog_Item* item) const
+{
+    cImage_Settings_Parser parser;
+    cImage_Settings_Data* p_settings = parser.Get(item->m_settings_path);
+
+    // Find the PNG of this settings file. If an equally named .png exists,
+    // assume that file, otherwise check the settings 'base' property. If
+    // that also doesn't exist, that's an error.
+    fs::path pixmap_path(item->m_settings_path); // Copy
+    pixmap_path.replace_extension(utf8_to_path(".png"));
+    if (!fs::exists(pixmap_path)) {
+        if (p_settings->m_base.empty()) { // Error
+            std::cerr << "PNG file for settings file '" << path_to_utf8(item->m_settings_path) << "' not found (no .png found and no 'base' setting)." << std::endl;
+            std::cerr << "Using dummy image instead." << std::endl;
+            pixmap_path = pResource_Manager->Get_Game_Pixmap("game/image_not_found.png");
+        }
+        else {
+            pixmap_path = pixmap_path.parent_path() / p_settings->m_base;
+            if (!fs::exists(pixmap_path)) {
+                std::cerr << "PNG base file not found at '" << path_to_utf8(pixmap_path) << "'." << std::endl;
+                std::cerr << "Using dummy image instead." << std::endl;
+                pixmap_path = pResource_Manager->Get_Game_Pixmap("game/image_not_found.png");
+            }
+        }
+    }
+
+    item->m_settings_time = Get_File_Time(item->m_settings_path);
+    item->m_pixmap_path = pixmap_path;
+    item->m_pixmap_time = Get_File_Time(pixmap_path);
+    item->m_name = p_settings->m_name;
+    item->m_editor_tags = p_settings->m_editor_tags;
+    item->m_massive_type = p_settings->m_massive_type;
+    item->m_rotation_x = static_cast<float>(p_settings->m_rotation_x);
+    item->m_rotation_y = static_cast<float>(p_settings->m_rotation_y);
+    item->m_rotation_z = static_cast<float>(p_settings->m_rotation_z);
+
+    delete p_settings;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -0,0 +1,96 @@
+/***************************************************************************
+ * editor_catalog.hpp - cached list of the editor image items
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_EDITOR_CATALOG_HPP
+#define TSC_EDITOR_CATALOG_HPP
+
+#ifdef ENABLE_EDITOR
+#include "../global_basic.hpp"
+#include "../global_game.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cEditor_Catalog_Item *** *** *** *** *** *** *** *** *** *** */
+
+    // An object which can be added from the editor menu
+    class cEditor_Catalog_Item {
+    public:
+        cEditor_Catalog_Item(void);
+
+        // settings file (empty for special items)
+        boost::filesystem::path m_settings_path;
+        // modification time of the settings and the image file
+        uint64_t m_settings_time;
+        uint64_t m_pixmap_time;
+        // image shown in the editor menu
+        boost::filesystem::path m_pixmap_path;
+        // name
+        std::string m_name;
+        // editor tags separated by ";"
+        std::string m_editor_tags;
+        // sprite massivity
+        MassiveType m_massive_type;
+        // rotation
+        float m_rotation_x, m_rotation_y, m_rotation_z;
+
+        // template sprite copied when adding the object
+        // created on first display for image items
+        cSprite* mp_template_sprite;
+    };
+
+    typedef vector<cEditor_Catalog_Item*> EditorCatalogItemList;
+
+    /* *** *** *** *** *** *** *** cEditor_Catalog *** *** *** *** *** *** *** *** *** *** */
+
+    /* The editor image items of all .settings files
+     *
+     * Parsing every settings file when the editor starts gets slow with
+     * a large pixmaps tree. The needed settings are cached in a text file
+     * and a settings file is only parsed again if it or its image changed.
+     * Changes of a base settings file are not detected.
+    */
+    class cEditor_Catalog {
+    public:
+        cEditor_Catalog(void);
+        ~cEditor_Catalog(void);
+
+        /* Set the items from the settings files in the directory
+         * filename : catalog cache file
+        */
+        void Update(const boost::filesystem::path& dir, const boost::filesystem::path& filename);
+        // Delete all items
+        void Clear(void);
+
+        // catalog items
+        EditorCatalogItemList m_items;
+
+        // cache file format version
+        static const int m_file_version;
+
+    private:
+        // Read the cache file
+        void Load(const boost::filesystem::path& filename, std::map<std::string, cEditor_Catalog_Item*>& items) const;
+        // Write the cache file
+        void Save(const boost::filesystem::path& filename) const;
+        // Parse the settings file of the item
+        void Parse_Settings(cEditor_Catalog_Item* item) const;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
+#endif
@@ -81,6 +81,22 @@ size_t Get_File_Size(const std::string& filename)
     return 0;
 }
 
+uint64_t Get_File_Time(const fs::path& filename)
+{
+    if (filename.empty()) {
+        return 0;
+    }
+
+    boost::system::error_code ec;
+    std::time_t time = fs::last_write_time(filename, ec);
+
+    if (ec || time < 0) {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(time);
+}
+
 void Convert_Path_Separators(std::string& str)
 {
     for (std::string::iterator itr = str.begin(); itr != str.end(); ++itr) {
@@ -42,6 +42,11 @@ namespace TSC {
     */
     size_t Get_File_Size(const std::string& filename);
 
+    /* Get the file modification time in seconds since the epoch.
+    * returns 0 if the file does not exist
+    */
+    uint64_t Get_File_Time(const boost::filesystem::path& filename);
+
 // Converts "\" and "!" to "/"
     void Convert_Path_Separators(std::string& str);
     void Convert_Path_Separators(boost::filesystem::path& path);
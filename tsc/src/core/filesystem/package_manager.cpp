@@ -24,6 +24,7 @@
 #include "filesystem.hpp"
 #include "relative.hpp"
 #include "../../user/preferences.hpp"
+#include "../../video/img_set.hpp"
 #include "../property_helper.hpp"
 #include "../errors.hpp"
 
@@ -164,6 +165,9 @@ void cPackage_Manager :: Set_Current_Package(const std::string& name)
 
     Build_Search_Path();
     Init_User_Paths();
+
+    // image set files and frames may resolve to other files now
+    cImageSet::Clear_Definitions();
 }
 
 std::string cPackage_Manager :: Get_Current_Package(void)
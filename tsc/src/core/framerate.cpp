@@ -18,6 +18,9 @@
 #include "game_core.hpp"
 #include "../core/framerate.hpp"
 #include "../core/math/utilities.hpp"
+#include "../core/alloc_tracker.hpp"
+
+using namespace std;
 
 namespace TSC {
 
@@ -38,6 +41,12 @@ void cPerformance_Timer::Reset(void)
     frame_counter = 0;
     ms_counter = 0;
     ms = 0;
+    frame_allocs = 0;
+    frame_alloc_bytes = 0;
+    allocs_counter = 0;
+    alloc_bytes_counter = 0;
+    allocs = 0;
+    alloc_bytes = 0;
 }
 
 void cPerformance_Timer::Update(void)
@@ -50,11 +59,28 @@ void cPerformance_Timer::Update(void)
     ms_counter += new_ticks - pFramerate->m_perf_last_ticks;
     pFramerate->m_perf_last_ticks = new_ticks;
 
+    // add heap allocations
+    const uint64_t new_allocs = Get_Allocation_Count();
+    const uint64_t new_alloc_bytes = Get_Allocated_Bytes();
+    const uint32_t section_allocs = static_cast<uint32_t>(new_allocs - pFramerate->m_perf_last_allocs);
+    const uint64_t section_alloc_bytes = new_alloc_bytes - pFramerate->m_perf_last_alloc_bytes;
+    pFramerate->m_perf_last_allocs = new_allocs;
+    pFramerate->m_perf_last_alloc_bytes = new_alloc_bytes;
+
+    frame_allocs += section_allocs;
+    frame_alloc_bytes += section_alloc_bytes;
+    allocs_counter += section_allocs;
+    alloc_bytes_counter += section_alloc_bytes;
+
     // counted 100 frames
     if (frame_counter >= 100) {
         ms = ms_counter;
+        allocs = allocs_counter;
+        alloc_bytes = alloc_bytes_counter;
         frame_counter = 0;
         ms_counter = 0;
+        allocs_counter = 0;
+        alloc_bytes_counter = 0;
     }
 }
 
@@ -73,9 +99,25 @@ cFramerate::cFramerate(void)
     m_last_ticks = 0;
     m_elapsed_ticks = 1;
     m_max_elapsed_ticks = 100;
+    m_frame_number = 0;
     m_speed_factor = 0.1f;
     m_force_speed_factor = 0.0f;
     m_perf_last_ticks = 0;
+    m_perf_last_allocs = 0;
+    m_perf_last_alloc_bytes = 0;
+    m_frame_last_allocs = Get_Allocation_Count();
+    m_alloc_budget = 0;
+    m_alloc_budget_strict = 0;
+
+#ifdef ENABLE_ALLOCATION_TRACKER
+    // allocation budget for level frames
+    const char* budget = getenv("TSC_ALLOCATION_BUDGET");
+
+    if (budget) {
+        m_alloc_budget = static_cast<uint32_t>(strtoul(budget, NULL, 10));
+        m_alloc_budget_strict = getenv("TSC_ALLOCATION_BUDGET_STRICT") != NULL;
+    }
+#endif
 
     // create performance timers
     for (unsigned int i = 0; i < 24; i++) {
@@ -102,10 +144,13 @@ void cFramerate::Init(const float target_fps /* = speedfactor_fps */)
     Reset();
 }
 
-void cFramerate::Update(void)
+void cFramerate::Update(const bool game_frame /* = 0 */)
 {
     const uint32_t current_ticks = TSC_GetTicks();
 
+    // the ticks may be the same in the next frame
+    m_frame_number++;
+
     // if speed factor is forced
     if (!Is_Float_Equal(m_force_speed_factor, 0.0f)) {
         m_speed_factor = m_force_speed_factor;
@@ -159,6 +204,39 @@ void cFramerate::Update(void)
     }
 
     m_last_ticks = current_ticks;
+
+#ifdef ENABLE_ALLOCATION_TRACKER
+    // check the heap allocations of this frame
+    const uint64_t current_allocs = Get_Allocation_Count();
+    const uint64_t frame_allocs = current_allocs - m_frame_last_allocs;
+
+    // only gameplay frames have a budget
+    if (m_alloc_budget && frame_allocs > m_alloc_budget && game_frame && Game_Mode == MODE_LEVEL && Game_Action == GA_NONE && !editor_level_enabled) {
+        cerr << "Warning: Frame allocation budget exceeded with " << frame_allocs << " allocations (budget " << m_alloc_budget << ")" << endl;
+
+        for (unsigned int i = 0; i < m_perf_timer.size(); i++) {
+            cPerformance_Timer* timer = m_perf_timer[i];
+
+            if (timer->frame_allocs) {
+                cerr << "  performance timer " << i << " : " << timer->frame_allocs << " allocations, " << timer->frame_alloc_bytes << " bytes" << endl;
+            }
+        }
+
+        // stop to be able to inspect it in the debugger
+        if (m_alloc_budget_strict) {
+            abort();
+        }
+    }
+
+    // the report above allocates as well
+    m_frame_last_allocs = Get_Allocation_Count();
+#endif
+
+    // start the next frame
+    for (Performance_Timer_List::iterator itr = m_perf_timer.begin(); itr != m_perf_timer.end(); ++itr) {
+        (*itr)->frame_allocs = 0;
+        (*itr)->frame_alloc_bytes = 0;
+    }
 }
 
 void cFramerate::Reset(void)
@@ -171,6 +249,8 @@ void cFramerate::Reset(void)
     m_fps_average = 0;
     m_fps_average_framedelay = m_last_ticks;
     m_frames_counted = 0;
+    // loading the level allocated a lot
+    m_frame_last_allocs = Get_Allocation_Count();
 
     // reset performance timer
     for (Performance_Timer_List::iterator itr = m_perf_timer.begin(); itr != m_perf_timer.end(); ++itr) {
@@ -178,6 +258,13 @@ void cFramerate::Reset(void)
     }
 }
 
+void cFramerate::Start_Perf_Section(void)
+{
+    m_perf_last_ticks = TSC_GetTicks();
+    m_perf_last_allocs = Get_Allocation_Count();
+    m_perf_last_alloc_bytes = Get_Allocated_Bytes();
+}
+
 void cFramerate::Set_Max_Elapsed_Ticks(const uint32_t ticks)
 {
     m_max_elapsed_ticks = ticks;
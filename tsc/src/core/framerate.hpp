@@ -41,6 +41,16 @@ namespace TSC {
         uint32_t ms_counter;
         // milliseconds per 100 frames
         uint32_t ms;
+
+        // heap allocations and bytes in the current frame
+        uint32_t frame_allocs;
+        uint64_t frame_alloc_bytes;
+        // current heap allocations and bytes counted
+        uint32_t allocs_counter;
+        uint64_t alloc_bytes_counter;
+        // heap allocations and bytes per 100 frames
+        uint32_t allocs;
+        uint64_t alloc_bytes;
     };
 
     /* *** *** *** *** *** *** *** cFramerate *** *** *** *** *** *** *** *** *** *** */
@@ -56,11 +66,20 @@ namespace TSC {
 
         // Initialize with the given target fps
         void Init(const float target_fps = speedfactor_fps);
-        // update speed factor
-        void Update(void);
+        /* update speed factor
+         * game_frame is set by the main game loop, the allocation
+         * budget is only checked for these frames and not for the
+         * frames of modal loops like fading or text boxes
+        */
+        void Update(const bool game_frame = 0);
         // reset speed factor and worst/best fps statistic
         void Reset(void);
 
+        /* Start a new performance measuring section
+         * the next performance timer update is measured from here
+        */
+        void Start_Perf_Section(void);
+
         // set maximum allowed elapsed ticks
         void Set_Max_Elapsed_Ticks(const uint32_t ticks);
 
@@ -92,6 +111,10 @@ namespace TSC {
         uint32_t m_elapsed_ticks;
         // maximum elapsed ticks
         uint32_t m_max_elapsed_ticks;
+        /* current frame number
+         * increased with every update and never reset
+        */
+        uint32_t m_frame_number;
 
         /* current factor
          * based on target fps
@@ -103,6 +126,20 @@ namespace TSC {
         // ## performance values ##
         // ticks since last section
         uint32_t m_perf_last_ticks;
+        // heap allocation counter values since last section
+        uint64_t m_perf_last_allocs;
+        uint64_t m_perf_last_alloc_bytes;
+        // heap allocation counter value at the frame start
+        uint64_t m_frame_last_allocs;
+
+        /* heap allocations allowed in a level frame
+         * if 0 it is not checked
+         * only used with ENABLE_ALLOCATION_TRACKER and set from
+         * the TSC_ALLOCATION_BUDGET environment variable
+        */
+        uint32_t m_alloc_budget;
+        // abort if the allocation budget is exceeded
+        bool m_alloc_budget_strict;
 
         typedef vector<cPerformance_Timer*> Performance_Timer_List;
         Performance_Timer_List m_perf_timer;
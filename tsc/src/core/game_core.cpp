@@ -153,6 +153,13 @@ void Handle_Game_Events(void)
             Handle_Generic_Game_Events(current_game_action_data_start);
             Leave_Game_Mode(new_mode);
             Handle_Generic_Game_Events(current_game_action_data_middle);
+
+            // the world could not be loaded
+            if (new_mode == MODE_OVERWORLD && !pActive_Overworld) {
+                new_mode = MODE_MENU;
+                pMenuCore->Load(MENU_MAIN);
+            }
+
             Enter_Game_Mode(new_mode);
             Handle_Generic_Game_Events(current_game_action_data_end);
         }
@@ -184,10 +191,19 @@ void Handle_Generic_Game_Events(const CEGUI::XMLAttributes& action_data)
     }
     // set active world
     if (action_data.exists("enter_world")) {
-        pOverworld_Manager->Set_Active(action_data.getValueAsString("enter_world").c_str());
+        std::string str_world = action_data.getValueAsString("enter_world").c_str();
+
+        // loading failed
+        if (!pOverworld_Manager->Set_Active(str_world)) {
+            cerr << "Error : Loading world failed " << str_world << endl;
+            pHud_Debug->Set_Text(_("Loading World failed : ") + str_world);
+
+            // no world to enter
+            pActive_Overworld = NULL;
+        }
     }
     // set player waypoint
-    if (action_data.exists("world_player_waypoint")) {
+    if (action_data.exists("world_player_waypoint") && pActive_Overworld) {
         // get world waypoint
         int waypoint_num = pActive_Overworld->Get_Waypoint_Num(action_data.getValueAsString("world_player_waypoint").c_str());
 
@@ -66,6 +66,8 @@
 #include <algorithm>
 #include <stdexcept>
 #include <map>
+#include <list>
+#include <unordered_map>
 #include <utility>
 #include <iomanip>
 
@@ -77,6 +79,7 @@
 #include <boost/filesystem/fstream.hpp>
 #include <boost/filesystem/convenience.hpp>
 #include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/chrono.hpp>
 #include <boost/system/error_code.hpp>
 
@@ -127,6 +130,8 @@
 #include <mruby/data.h>
 #include <mruby/variable.h>
 #include <mruby/proc.h>
+#include <mruby/irep.h>
+#include <mruby/dump.h>
 #include <mruby/range.h>
 
 // tinyclipboard
@@ -311,6 +311,30 @@ namespace TSC {
         ARRAY_LAVA = 8
     };
 
+    /* *** Sprite activity states *** */
+// Chosen each frame by the distance to the camera and the player.
+
+    enum SpriteActivity {
+        // updated every frame
+        ACTIVITY_AWAKE = 0,
+        // updated every few frames with the speedfactor of the skipped frames
+        ACTIVITY_REDUCED = 1,
+        // not updated
+        ACTIVITY_ASLEEP = 2
+    };
+
+    /* *** Sprite sleep policies *** */
+// How a sprite behaves far away from the camera and the player.
+
+    enum SleepPolicy {
+        // always updated
+        SLEEP_NEVER = 0,
+        // updated at a reduced rate when far away but never asleep
+        SLEEP_REDUCED = 1,
+        // updated at a reduced rate when far away and asleep when even farther
+        SLEEP_FULL = 2
+    };
+
     /* *** collision validation types *** */
 
     enum Col_Valid_Type {
@@ -429,6 +453,7 @@ namespace TSC {
     class cSize_Int;
     class cSprite_Manager;
     class cSurface_Request;
+    class cTexture_Cache_Writer;
     class cSprite;
     class cBackground_Manager;
     class cWorld_Sprite_Manager;
@@ -0,0 +1,154 @@
+/***************************************************************************
+ * job_pool.cpp - worker threads for parallel update phases
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/job_pool.hpp"
+#include "../core/global_basic.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cJob_Pool *** *** *** *** *** *** *** *** *** *** */
+
+cJob_Pool::cJob_Pool(unsigned int thread_count)
+{
+    m_function = NULL;
+    m_job_number = 0;
+    m_count = 0;
+    m_range_size = 0;
+    m_next_index = 0;
+    m_finished = 0;
+    m_exit = 0;
+
+    for (unsigned int i = 0; i < thread_count; i++) {
+        m_threads.push_back(new boost::thread(&cJob_Pool::Worker, this));
+    }
+}
+
+cJob_Pool::~cJob_Pool(void)
+{
+    {
+        boost::unique_lock<boost::mutex> lock(m_mutex);
+        m_exit = 1;
+        m_job_condition.notify_all();
+    }
+
+    for (ThreadList::iterator itr = m_threads.begin(); itr != m_threads.end(); ++itr) {
+        (*itr)->join();
+        delete *itr;
+    }
+
+    m_threads.clear();
+}
+
+void cJob_Pool::Run(unsigned int count, const Job_Function& function, unsigned int min_range /* = 64 */)
+{
+    if (!count) {
+        return;
+    }
+
+    // not worth waking the workers
+    if (m_threads.empty() || count <= min_range) {
+        function(0, count);
+        return;
+    }
+
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    m_function = &function;
+    m_count = count;
+    m_next_index = 0;
+    m_finished = 0;
+    // a few ranges per thread so a slow range does not stall the others
+    m_range_size = max(min_range, count / (Get_Thread_Count() * 4) + 1);
+    m_job_number++;
+
+    m_job_condition.notify_all();
+
+    Run_Ranges(lock);
+
+    // wait for the ranges still running in the workers
+    while (m_finished < m_count) {
+        m_done_condition.wait(lock);
+    }
+
+    m_function = NULL;
+}
+
+unsigned int cJob_Pool::Get_Thread_Count(void) const
+{
+    return m_threads.size() + 1;
+}
+
+unsigned int cJob_Pool::Get_Default_Thread_Count(void)
+{
+    const unsigned int cores = boost::thread::hardware_concurrency();
+
+    // unknown or single core
+    if (cores < 2) {
+        return 0;
+    }
+
+    // the render and audio threads need some time too
+    return min(cores - 1, 7u);
+}
+
+void cJob_Pool::Worker(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+    unsigned int job_number = m_job_number;
+
+    while (1) {
+        while (!m_exit && m_job_number == job_number) {
+            m_job_condition.wait(lock);
+        }
+
+        if (m_exit) {
+            return;
+        }
+
+        job_number = m_job_number;
+        Run_Ranges(lock);
+    }
+}
+
+void cJob_Pool::Run_Ranges(boost::unique_lock<boost::mutex>& lock)
+{
+    while (m_function && m_next_index < m_count) {
+        const Job_Function* function = m_function;
+        const unsigned int start = m_next_index;
+        const unsigned int end = min(start + m_range_size, m_count);
+
+        m_next_index = end;
+
+        lock.unlock();
+        (*function)(start, end);
+        lock.lock();
+
+        m_finished += end - start;
+
+        if (m_finished == m_count) {
+            m_done_condition.notify_all();
+        }
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cJob_Pool* pJob_Pool = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
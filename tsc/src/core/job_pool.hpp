@@ -0,0 +1,99 @@
+/***************************************************************************
+ * job_pool.hpp - worker threads for parallel update phases
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_JOB_POOL_HPP
+#define TSC_JOB_POOL_HPP
+
+#include "../core/global_basic.hpp"
+#include <boost/thread/condition_variable.hpp>
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cJob_Pool *** *** *** *** *** *** *** *** *** *** */
+
+    /* A fixed number of worker threads running index ranges of a job
+     *
+     * Run() splits the indices into ranges which are run by the workers
+     * and the calling thread and returns when all are done. The job
+     * function may only change the data of its own indices, anything
+     * else like deleting objects or calling rand() must be done by the
+     * caller afterwards in index order. This keeps the results the same
+     * for any number of threads.
+    */
+    class cJob_Pool {
+    public:
+        // function called with the index range [start, end)
+        typedef boost::function<void (unsigned int start, unsigned int end)> Job_Function;
+
+        // thread_count : number of worker threads besides the main thread
+        cJob_Pool(unsigned int thread_count);
+        // Stops the worker threads
+        ~cJob_Pool(void);
+
+        /* Call the function for all indices from 0 to count
+         * min_range : smallest number of indices run at once, fewer run directly in this thread
+         * Main thread only.
+        */
+        void Run(unsigned int count, const Job_Function& function, unsigned int min_range = 64);
+
+        // Return the number of threads used including the main thread
+        unsigned int Get_Thread_Count(void) const;
+
+        // Return the worker thread count for this machine
+        static unsigned int Get_Default_Thread_Count(void);
+
+    private:
+        // Worker thread function
+        void Worker(void);
+        // Run ranges until none are left. The lock must be held.
+        void Run_Ranges(boost::unique_lock<boost::mutex>& lock);
+
+        typedef vector<boost::thread*> ThreadList;
+        ThreadList m_threads;
+
+        // guards all job data
+        boost::mutex m_mutex;
+        // signals a new job or exit to the workers
+        boost::condition_variable m_job_condition;
+        // signals finished ranges to Run()
+        boost::condition_variable m_done_condition;
+
+        // current job
+        const Job_Function* m_function;
+        // increased for each job
+        unsigned int m_job_number;
+        // index count and range size
+        unsigned int m_count;
+        unsigned int m_range_size;
+        // first index not yet started
+        unsigned int m_next_index;
+        // indices finished
+        unsigned int m_finished;
+        // workers should exit
+        bool m_exit;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Job Pool
+    extern cJob_Pool* pJob_Pool;
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -23,6 +23,7 @@
 #include "../level/level.hpp"
 #include "../gui/menu.hpp"
 #include "../core/framerate.hpp"
+#include "../core/job_pool.hpp"
 #include "../video/font.hpp"
 #include "../user/preferences.hpp"
 #include "../audio/sound_manager.hpp"
@@ -32,6 +33,7 @@
 #include "../level/level_editor.hpp"
 #include "../overworld/world_editor.hpp"
 #include "../input/joystick.hpp"
+#include "../input/input_actions.hpp"
 #include "../overworld/world_manager.hpp"
 #include "../overworld/overworld.hpp"
 #include "../campaign/campaign_manager.hpp"
@@ -214,7 +216,7 @@ int main(int argc, char** argv)
 #endif
 
             // update speedfactor
-            pFramerate->Update();
+            pFramerate->Update(1);
         }
 
         Exit_Game();
@@ -248,6 +250,7 @@ void Init_Game(void)
     pImage_Manager = new cImage_Manager();
     pSound_Manager = new cSound_Manager();
     pSettingsParser = new cImage_Settings_Parser();
+    pJob_Pool = new cJob_Pool(cJob_Pool::Get_Default_Thread_Count());
 
     // Init Stage 2 - set preferences and init audio and the video screen
 
@@ -315,6 +318,7 @@ void Init_Game(void)
     pMouseCursor = new cMouseCursor(pActive_Level->m_sprite_manager);
     pKeyboard = new cKeyboard();
     pJoystick = new cJoystick();
+    pInput_Actions = new cInput_Actions();
     pLevel_Manager->Init();
     // note : set any sprite manager as cOverworld_Manager::Load sets it again
     pOverworld_Player = new cOverworld_Player(pActive_Level->m_sprite_manager, NULL);
@@ -390,6 +394,11 @@ void Exit_Game(void)
         pMouseCursor = NULL;
     }
 
+    if (pInput_Actions) {
+        delete pInput_Actions;
+        pInput_Actions = NULL;
+    }
+
     if (pJoystick) {
         delete pJoystick;
         pJoystick = NULL;
@@ -464,6 +473,11 @@ void Exit_Game(void)
         delete pResource_Manager;
         pResource_Manager = NULL;
     }
+
+    if (pJob_Pool) {
+        delete pJob_Pool;
+        pJob_Pool = NULL;
+    }
 }
 
 bool Handle_Input_Global(const sf::Event& ev)
@@ -584,10 +598,15 @@ void Update_Game(void)
     // Actually `input_event' is a global variable that is also queried elsewhere
     // in the code (uaaah, poor design).
     while (pVideo->mp_window->pollEvent(input_event)) {
+        // keep the game actions current for the handlers
+        pInput_Actions->Handle_Event(input_event);
         // handle
         Handle_Input_Global(input_event);
     }
 
+    // game actions of this frame
+    pInput_Actions->Update();
+
     pMouseCursor->Update();
 
     // ## audio
@@ -595,7 +614,7 @@ void Update_Game(void)
     pAudio->Update();
 
     // performance measuring
-    pFramerate->m_perf_last_ticks = TSC_GetTicks();
+    pFramerate->Start_Perf_Section();
 
     // ## update
     if (Game_Mode == MODE_LEVEL) {
@@ -625,7 +644,7 @@ void Draw_Game(void)
     }
 
     // performance measuring
-    pFramerate->m_perf_last_ticks = TSC_GetTicks();
+    pFramerate->Start_Perf_Section();
 
     if (Game_Mode == MODE_LEVEL) {
         pLevel_Manager->Draw();
@@ -18,6 +18,7 @@
 #include "../core/i18n.hpp"
 #include "../video/color.hpp"
 #include "../objects/sprite.hpp"
+#include <limits>
 
 namespace TSC {
 
@@ -257,59 +258,210 @@ std::string float_to_string(double value, int prec /* = 6 */, bool keep_zeros /*
     return str;
 }
 
-// string conversion helper
-template <class T> bool from_string(T& t, const std::string& s, std::ios_base &(*f)(std::ios_base&))
+/* Number parsing like operator>> of a stream in the "C" locale
+ * The streams are slow to construct for the many small strings of the
+ * XML files. The leading number of the string is used, whitespace is
+ * skipped and 0 is returned if there is none.
+*/
+
+static const char* Skip_Number_Spaces(const char* str)
+{
+    while (*str == ' ' || (*str >= '\t' && *str <= '\r')) {
+        str++;
+    }
+
+    return str;
+}
+
+template <class T> static T Parse_Integer(const std::string& str)
+{
+    const char* pos = Skip_Number_Spaces(str.c_str());
+    bool negative = 0;
+
+    if (*pos == '-' || *pos == '+') {
+        negative = *pos == '-';
+        pos++;
+    }
+
+    if (*pos < '0' || *pos > '9') {
+        return 0;
+    }
+
+    uint64_t value = 0;
+    bool overflow = 0;
+
+    for (; *pos >= '0' && *pos <= '9'; pos++) {
+        const unsigned int digit = *pos - '0';
+
+        if (value > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+            overflow = 1;
+        }
+        else {
+            value = (value * 10) + digit;
+        }
+    }
+
+    // out of range is set to the limit like the streams do
+    if (std::numeric_limits<T>::is_signed) {
+        const uint64_t limit = static_cast<uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1 : 0);
+
+        if (overflow || value > limit) {
+            return negative ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+        }
+
+        if (negative) {
+            return static_cast<T>(-static_cast<int64_t>(value - 1) - 1);
+        }
+
+        return static_cast<T>(value);
+    }
+
+    if (overflow || value > static_cast<uint64_t>(std::numeric_limits<T>::max())) {
+        return std::numeric_limits<T>::max();
+    }
+
+    // negative unsigned numbers wrap around
+    if (negative) {
+        return static_cast<T>(0 - value);
+    }
+
+    return static_cast<T>(value);
+}
+
+template <class T> static T Parse_Float(const std::string& str)
 {
-    std::istringstream iss(s);
-    return !(iss >> f >> t).fail();
+    /* A mantissa and power of ten which are both exact in T give the correctly
+     * rounded result with a single multiplication or division. Powers of
+     * ten are exact up to 1e22 for double and 1e10 for float.
+     */
+    static const T powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    static const uint64_t max_mantissa = 1ULL << std::numeric_limits<T>::digits;
+    static const int max_exponent = std::numeric_limits<T>::digits > 24 ? 22 : 10;
+
+    const char* pos = Skip_Number_Spaces(str.c_str());
+    bool negative = 0;
+
+    if (*pos == '-' || *pos == '+') {
+        negative = *pos == '-';
+        pos++;
+    }
+
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    bool digits = 0;
+    // more digits than the mantissa can take exactly
+    bool exact = 1;
+
+    // integer part
+    for (; *pos >= '0' && *pos <= '9'; pos++) {
+        digits = 1;
+
+        if (mantissa < max_mantissa) {
+            mantissa = (mantissa * 10) + (*pos - '0');
+        }
+        else {
+            exact = 0;
+        }
+    }
+
+    // fraction
+    if (*pos == '.') {
+        pos++;
+
+        for (; *pos >= '0' && *pos <= '9'; pos++) {
+            digits = 1;
+
+            if (mantissa < max_mantissa) {
+                mantissa = (mantissa * 10) + (*pos - '0');
+                exponent--;
+            }
+            else {
+                exact = 0;
+            }
+        }
+    }
+
+    if (!digits) {
+        return 0;
+    }
+
+    if (*pos == 'e' || *pos == 'E') {
+        pos++;
+        bool exponent_negative = 0;
+
+        if (*pos == '-' || *pos == '+') {
+            exponent_negative = *pos == '-';
+            pos++;
+        }
+
+        // an incomplete exponent fails like in the streams
+        if (*pos < '0' || *pos > '9') {
+            return 0;
+        }
+
+        int exponent_value = 0;
+
+        for (; *pos >= '0' && *pos <= '9'; pos++) {
+            if (exponent_value < 10000) {
+                exponent_value = (exponent_value * 10) + (*pos - '0');
+            }
+        }
+
+        exponent += exponent_negative ? -exponent_value : exponent_value;
+    }
+
+    if (mantissa == 0) {
+        return negative ? -static_cast<T>(0) : static_cast<T>(0);
+    }
+
+    // the stream rounds correctly where the fast way can not
+    if (!exact || mantissa > max_mantissa || exponent > max_exponent || exponent < -max_exponent) {
+        std::istringstream stream(str);
+        T value = 0;
+        stream >> value;
+        return value;
+    }
+
+    T value = static_cast<T>(mantissa);
+
+    if (exponent > 0) {
+        value *= powers[exponent];
+    }
+    else if (exponent < 0) {
+        value /= powers[-exponent];
+    }
+
+    return negative ? -value : value;
 }
 
 int string_to_int(const std::string& str)
 {
-    int num = 0;
-    // use helper
-    from_string<int>(num, str, std::dec);
-    return num;
+    return Parse_Integer<int>(str);
 }
 
 unsigned int string_to_uint(const std::string& str)
 {
-    unsigned int num = 0;
-    // use helper
-    from_string<unsigned int>(num, str, std::dec);
-    return num;
+    return Parse_Integer<unsigned int>(str);
 }
 
 uint64_t string_to_int64(const std::string& str)
 {
-    uint64_t num = 0;
-    // use helper
-    from_string<uint64_t>(num, str, std::dec);
-    return num;
+    return Parse_Integer<uint64_t>(str);
 }
 
 long string_to_long(const std::string& str)
 {
-    long num = 0;
-    // use helper
-    from_string<long>(num, str, std::dec);
-    return num;
+    return Parse_Integer<long>(str);
 }
 
 float string_to_float(const std::string& str)
 {
-    float num = 0.0f;
-    // use helper
-    from_string<float>(num, str, std::dec);
-    return num;
+    return Parse_Float<float>(str);
 }
 
 double string_to_double(const std::string& str)
 {
-    double num = 0.0;
-    // use helper
-    from_string<double>(num, str, std::dec);
-    return num;
+    return Parse_Float<double>(str);
 }
 
 bool string_to_bool(const std::string& str)
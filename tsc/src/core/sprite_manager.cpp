@@ -18,6 +18,8 @@
 #include "../core/game_core.hpp"
 #include "../level/level_player.hpp"
 #include "../input/mouse.hpp"
+#include "../core/framerate.hpp"
+#include "../core/job_pool.hpp"
 #include "../overworld/world_player.hpp"
 #include "../enemies/enemy.hpp"
 #include "../core/global_basic.hpp"
@@ -28,6 +30,9 @@ namespace TSC {
 
 /* *** *** *** *** *** *** cSprite_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
+const uint32_t cSprite_Manager::m_reduced_update_frames = 4;
+uint32_t cSprite_Manager::m_delete_count = 0;
+
 cSprite_Manager::cSprite_Manager(unsigned int reserve_items /* = 2000 */, unsigned int zpos_items /* = 100 */)
     : cObject_Manager<cSprite>()
 {
@@ -36,6 +41,7 @@ cSprite_Manager::cSprite_Manager(unsigned int reserve_items /* = 2000 */, unsign
     m_max_uid_mark = 1; // UID 0 is reserved for the player
     m_z_pos_data.assign(zpos_items, 0.0f);
     m_z_pos_data_editor.assign(zpos_items,0.0f);
+    m_update_frame = 0;
 }
 
 cSprite_Manager::~cSprite_Manager(void)
@@ -87,18 +93,21 @@ void cSprite_Manager::Add(cSprite* sprite)
         if (obj->m_auto_destroy) {
             // set new object
             *itr = sprite;
+            sprite->m_array_num = itr - objects.begin();
 
             // Release old sprite’s UID by putting it back into the UID pool
             m_uid_pool.insert(obj->m_uid);
 
             // delete old
             delete obj;
+            m_delete_count++;
 
             return;
         }
     }
 
     cObject_Manager<cSprite>::Add(sprite);
+    sprite->m_array_num = objects.size() - 1;
 }
 
 cSprite* cSprite_Manager::Copy(unsigned int identifier)
@@ -177,6 +186,7 @@ void cSprite_Manager::Move_To_Front(cSprite* sprite)
     objects.erase(itr);
     objects.front() = sprite;
     objects.insert(objects.begin() + 1, first);
+    Update_Array_Nums();
 
     // make it the first z position
     sprite->m_pos_z = Get_First(sprite->m_type)->m_pos_z - cSprite::m_pos_z_delta;
@@ -208,11 +218,35 @@ void cSprite_Manager::Move_To_Back(cSprite* sprite)
     objects.erase(itr);
     objects.back() = sprite;
     objects.insert(objects.end() - 1, last);
+    Update_Array_Nums();
 
     // make it the last z position
     Ensure_Different_Z(sprite);
 }
 
+int cSprite_Manager::Get_Array_Num(cSprite* obj) const
+{
+    // invalid
+    if (!obj) {
+        return -1;
+    }
+
+    // slot is valid
+    if (obj->m_array_num >= 0 && static_cast<size_t>(obj->m_array_num) < objects.size() && objects[obj->m_array_num] == obj) {
+        return obj->m_array_num;
+    }
+
+    // not added by us or array changed without updating the slot
+    return cObject_Manager<cSprite>::Get_Array_Num(obj);
+}
+
+void cSprite_Manager::Update_Array_Nums(void)
+{
+    for (size_t i = 0; i < objects.size(); i++) {
+        objects[i]->m_array_num = static_cast<int>(i);
+    }
+}
+
 void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
 {
     // delayed
@@ -232,6 +266,7 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
             cSprite* obj = (*itr);
 
             if (obj->m_disallow_managed_delete) {
+                obj->m_array_num = -1;
                 itr = objects.erase(itr);
             }
             // increment
@@ -241,6 +276,7 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
         }
 
         cObject_Manager<cSprite>::Delete_All();
+        m_delete_count++;
     }
 
     // Empty the UID pool, we have no sprites anymore
@@ -396,26 +432,121 @@ void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_
     }
 }
 
+void cSprite_Manager::Update_Items_Valid_Draw(void)
+{
+    // only reads the global state and sets the own validation
+    pJob_Pool->Run(objects.size(), boost::bind(&cSprite_Manager::Update_Items_Valid_Draw_Range, this, _1, _2), 256);
+}
+
+void cSprite_Manager::Update_Items_Valid_Draw_Range(unsigned int start, unsigned int end)
+{
+    for (unsigned int i = start; i < end; i++) {
+        objects[i]->Update_Valid_Draw();
+    }
+}
+
+void cSprite_Manager::Update_Items(void)
+{
+    m_update_frame++;
+
+    const float speed_factor = pFramerate->m_speed_factor;
+
+    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+        const SpriteActivity activity = obj->Update_Activity();
+
+        if (activity == ACTIVITY_AWAKE) {
+            obj->Update();
+            continue;
+        }
+
+        if (activity == ACTIVITY_ASLEEP) {
+            continue;
+        }
+
+        obj->m_skipped_speed_factor += speed_factor;
+
+        // spread the reduced updates over the frames
+        if ((m_update_frame + static_cast<uint32_t>(obj->m_uid)) % m_reduced_update_frames) {
+            continue;
+        }
+
+        // update with the time of all skipped frames
+        pFramerate->m_speed_factor = obj->m_skipped_speed_factor;
+        obj->m_skipped_speed_factor = 0.0f;
+        obj->Update();
+        pFramerate->m_speed_factor = speed_factor;
+    }
+}
+
 void cSprite_Manager::Handle_Collision_Items(void)
 {
+    m_carried_items.clear();
+
     for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         cSprite* obj = (*itr);
 
-        // invalid
-        if (obj->m_auto_destroy) {
-            if (obj->m_collisions.size()) {
-                debug_print("Collision with a destroyed object (%s)\n", obj->Create_Name().c_str());
-                obj->Clear_Collisions();
+        // carried objects wait for their carrier
+        if (!obj->m_auto_destroy && obj->Get_Carrier()) {
+            m_carried_items.push_back(obj);
+            continue;
+        }
+
+        Handle_Collision_Item(obj);
+    }
+
+    // carried objects in carrier order
+    while (!m_carried_items.empty()) {
+        m_carried_items_next.clear();
+
+        for (cSprite_List::iterator itr = m_carried_items.begin(); itr != m_carried_items.end(); ++itr) {
+            cSprite* obj = (*itr);
+            cSprite_List::iterator carrier_itr = std::find(m_carried_items.begin(), m_carried_items.end(), obj->Get_Carrier());
+
+            // carrier is also carried and not yet handled
+            if (carrier_itr != m_carried_items.end() && (carrier_itr > itr || std::find(m_carried_items_next.begin(), m_carried_items_next.end(), *carrier_itr) != m_carried_items_next.end())) {
+                m_carried_items_next.push_back(obj);
+                continue;
             }
 
-            continue;
+            Handle_Collision_Item(obj);
+        }
+
+        // objects carrying each other
+        if (m_carried_items_next.size() == m_carried_items.size()) {
+            for (cSprite_List::iterator itr = m_carried_items_next.begin(); itr != m_carried_items_next.end(); ++itr) {
+                Handle_Collision_Item(*itr);
+            }
+
+            m_carried_items_next.clear();
+        }
+
+        m_carried_items.swap(m_carried_items_next);
+    }
+}
+
+void cSprite_Manager::Handle_Collision_Item(cSprite* obj)
+{
+    // invalid
+    if (obj->m_auto_destroy) {
+        if (obj->m_collisions.size()) {
+            debug_print("Collision with a destroyed object (%s)\n", obj->Create_Name().c_str());
+            obj->Clear_Collisions();
         }
 
-        // collision and movement handling
-        obj->Collide_Move();
-        // handle found collisions
-        obj->Handle_Collisions();
+        return;
+    }
+
+    // collision and movement handling
+    obj->Collide_Move();
+
+    // collisions from other sprites wake it up
+    if (!obj->m_collisions.empty()) {
+        obj->Wake_Up();
     }
+
+    // handle found collisions
+    obj->Handle_Collisions();
 }
 
 unsigned int cSprite_Manager::Get_Size_Array(const ArrayType sprite_array)
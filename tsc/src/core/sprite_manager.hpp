@@ -50,6 +50,11 @@ namespace TSC {
         */
         void Move_To_Back(cSprite* sprite);
 
+        /* Return the object array number from the slot kept in the sprite
+         * if not found returns -1
+        */
+        int Get_Array_Num(cSprite* obj) const;
+
         /* Delete all objects
          * if delayed is set deletion will only occur if replaced
          */
@@ -81,25 +86,20 @@ namespace TSC {
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
 
-        // Update items drawing validation
-        inline void Update_Items_Valid_Draw(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Update_Valid_Draw();
-            }
-        }
-        // Update items
-        inline void Update_Items(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Update();
-            }
-        }
-        // Update_Late items
+        // Update items drawing validation on all job pool threads
+        void Update_Items_Valid_Draw(void);
+        /* Update items
+         * Sprites far away from the camera and the player are updated
+         * at a reduced rate or not at all depending on their sleep policy.
+        */
+        void Update_Items(void);
+        // Update_Late items which are not asleep
         inline void Update_Items_Late(void)
         {
             for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Update_Late();
+                if ((*itr)->m_activity != ACTIVITY_ASLEEP) {
+                    (*itr)->Update_Late();
+                }
             }
         }
         // Draw items
@@ -110,7 +110,10 @@ namespace TSC {
             }
         }
 
-        // Create Collision data and Handle the collisions
+        /* Create Collision data and Handle the collisions
+         * Objects carried by another object are handled after their carrier
+         * so they can move with the carrier position change of this frame.
+        */
         void Handle_Collision_Items(void);
 
 
@@ -147,6 +150,15 @@ namespace TSC {
         // The UID pool is filled as needed. This is always the first
         // non-yet allocated UID.
         int m_max_uid_mark;
+        // frames updated for the reduced activity state
+        uint32_t m_update_frame;
+        // frames between the updates of reduced activity sprites
+        static const uint32_t m_reduced_update_frames;
+        // number of deleted sprites in all managers
+        static uint32_t m_delete_count;
+        // carried objects waiting for their carrier in Handle_Collision_Items
+        cSprite_List m_carried_items;
+        cSprite_List m_carried_items_next;
 
         // Z position sort
         struct zpos_sort {
@@ -182,6 +194,13 @@ namespace TSC {
         };
 
     private:
+        // Update the drawing validation of the given object range
+        void Update_Items_Valid_Draw_Range(unsigned int start, unsigned int end);
+        // Create Collision data and Handle the collisions of the given object
+        void Handle_Collision_Item(cSprite* obj);
+        // Set the slot of all objects to their array number
+        void Update_Array_Nums(void);
+
         /* When multiple sprites of the same massivity are placed
          * on the same place (think two hills before one another,
          * where one may be higher than the other), they would
@@ -19,6 +19,74 @@
 
 namespace TSC {
 
+XmlAttributes::XmlAttributes(void)
+{
+    //
+}
+
+std::string& XmlAttributes::operator[](const std::string& key)
+{
+    iterator itr = find(key);
+
+    if (itr != m_list.end())
+        return itr->second;
+
+    if (m_list.capacity() == 0)
+        m_list.reserve(m_reserve_size);
+
+    m_list.push_back(value_type(key, std::string()));
+    return m_list.back().second;
+}
+
+XmlAttributes::iterator XmlAttributes::find(const std::string& key)
+{
+    for (iterator itr = m_list.begin(); itr != m_list.end(); ++itr) {
+        if (itr->first == key)
+            return itr;
+    }
+
+    return m_list.end();
+}
+
+XmlAttributes::const_iterator XmlAttributes::find(const std::string& key) const
+{
+    for (const_iterator itr = m_list.begin(); itr != m_list.end(); ++itr) {
+        if (itr->first == key)
+            return itr;
+    }
+
+    return m_list.end();
+}
+
+size_t XmlAttributes::count(const std::string& key) const
+{
+    if (find(key) != m_list.end())
+        return 1;
+    else
+        return 0;
+}
+
+size_t XmlAttributes::erase(const std::string& key)
+{
+    iterator itr = find(key);
+
+    if (itr == m_list.end())
+        return 0;
+
+    m_list.erase(itr);
+    return 1;
+}
+
+void XmlAttributes::clear(void)
+{
+    m_list.clear();
+}
+
+void XmlAttributes::swap(XmlAttributes& other)
+{
+    m_list.swap(other.m_list);
+}
+
 void XmlAttributes::relocate_image(const std::string& filename_old, const std::string& filename_new, const std::string& attribute_name /* = "image" */)
 {
     std::string current_value = (*this)[attribute_name];
@@ -30,9 +98,6 @@ void XmlAttributes::relocate_image(const std::string& filename_old, const std::s
 
 bool XmlAttributes::exists(const std::string& key)
 {
-    if (count(key) > 0)
-        return true;
-    else
-        return false;
+    return find(key) != m_list.end();
 }
 }
@@ -21,8 +21,41 @@
 
 namespace TSC {
 
-    class XmlAttributes: public std::map<std::string, std::string> {
+    /* The properties of an XML element
+     * They are kept in a flat list in the order they were added. For the
+     * few properties of an element this is faster than a map and needs
+     * a single allocation instead of one per property. The interface is
+     * the used part of std::map.
+    */
+    class XmlAttributes {
     public:
+        typedef std::pair<std::string, std::string> value_type;
+        typedef std::vector<value_type> List;
+        typedef List::iterator iterator;
+        typedef List::const_iterator const_iterator;
+
+        XmlAttributes(void);
+
+        // Return the value of the given key. It is added empty if it does not exist.
+        std::string& operator[](const std::string& key);
+        // Return the entry of the given key or end() if it does not exist
+        iterator find(const std::string& key);
+        const_iterator find(const std::string& key) const;
+        // Return 1 if the given key exists, otherwise 0
+        size_t count(const std::string& key) const;
+        // Remove the given key and return the number of removed entries
+        size_t erase(const std::string& key);
+        // Remove all entries but keep the memory
+        void clear(void);
+        void swap(XmlAttributes& other);
+
+        iterator begin(void) { return m_list.begin(); }
+        iterator end(void) { return m_list.end(); }
+        const_iterator begin(void) const { return m_list.begin(); }
+        const_iterator end(void) const { return m_list.end(); }
+        size_t size(void) const { return m_list.size(); }
+        bool empty(void) const { return m_list.empty(); }
+
         // If the given key `attribute_name' has the value `filename_old'
         //(either with or without the pixmaps dir), replace it with `filename_new'.
         void relocate_image(const std::string& filename_old, const std::string& filename_new, const std::string& attribute_name = "image");
@@ -35,8 +68,10 @@ namespace TSC {
         template <typename T>
         T fetch(const std::string& key, T defaultvalue)
         {
-            if (exists(key))
-                return string_to_type<T>((*this)[key]);
+            const_iterator itr = find(key);
+
+            if (itr != m_list.end())
+                return string_to_type<T>(itr->second);
             else
                 return defaultvalue;
         }
@@ -47,18 +82,28 @@ namespace TSC {
         template <typename T>
         T retrieve(const std::string& key)
         {
-            if (exists(key))
-                return string_to_type<T>((*this)[key]);
+            const_iterator itr = find(key);
+
+            if (itr != m_list.end())
+                return string_to_type<T>(itr->second);
             else
                 throw (XmlKeyDoesNotExist(key));
         }
+
+        // entries reserved at once, most elements have fewer properties
+        static const size_t m_reserve_size = 16;
+
+    private:
+        List m_list;
     };
 
     template<>
     inline std::string XmlAttributes::fetch(const std::string& key, std::string defaultvalue)
     {
-        if (exists(key))
-            return (*this)[key];
+        const_iterator itr = find(key);
+
+        if (itr != m_list.end())
+            return itr->second;
         else
             return defaultvalue;
     }
@@ -66,8 +111,10 @@ namespace TSC {
     template<>
     inline const char* XmlAttributes::fetch(const std::string& key, const char* defaultvalue)
     {
-        if (exists(key))
-            return (*this)[key].c_str();
+        const_iterator itr = find(key);
+
+        if (itr != m_list.end())
+            return itr->second.c_str();
         else
             return defaultvalue;
     }
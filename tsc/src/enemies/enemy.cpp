@@ -38,6 +38,7 @@ cEnemy::cEnemy(cSprite_Manager* sprite_manager)
     m_type = TYPE_ENEMY;
 
     m_camera_range = 1500;
+    m_sleep_policy = SLEEP_FULL;
 
     m_massive_type = MASS_MASSIVE;
     m_state = STA_FALL;
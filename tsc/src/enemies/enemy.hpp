@@ -94,8 +94,8 @@ namespace TSC {
         // default counter for animations
         float m_counter;
 
-        // sound filename if got killed
-        std::string m_kill_sound;
+        // sound if got killed
+        cSound_Handle m_kill_sound;
         // points if enemy got killed
         unsigned int m_kill_points;
 
@@ -143,7 +143,7 @@ xmlpp::Element* cStaticEnemy::Save_To_XML_Node(xmlpp::Element* p_element)
 
 void cStaticEnemy::Set_Sprite_Manager(cSprite_Manager* sprite_manager)
 {
-    cSprite::Set_Sprite_Manager(sprite_manager);
+    cEnemy::Set_Sprite_Manager(sprite_manager);
     m_path_state.Set_Sprite_Manager(sprite_manager);
 }
 
@@ -371,6 +371,8 @@ cStatusText::cStatusText()
 {
     m_x = 0;
     m_y = 0;
+    m_value = 0;
+    m_value_valid = 0;
     // OLD Set_Shadow(black, 1.5f);
 }
 
@@ -396,6 +398,17 @@ void cStatusText::Prepare_Text_For_SFML(const std::string& text, int fontsize, C
     pFont->Prepare_SFML_Text(m_text, text, m_x, m_y, fontsize, color, true);
 }
 
+bool cStatusText::Is_Value_Changed(int64_t value)
+{
+    if (m_value_valid && m_value == value) {
+        return 0;
+    }
+
+    m_value = value;
+    m_value_valid = 1;
+    return 1;
+}
+
 void cStatusText::Update()
 {
     // Nothing by default
@@ -457,6 +470,10 @@ void cPlayerPoints::Set_Points(long points)
 {
     pLevel_Player->m_points = points;
 
+    if (!Is_Value_Changed(pLevel_Player->m_points)) {
+        return;
+    }
+
     char text[70];
     sprintf(text, _("Points %08d"), static_cast<int>(pLevel_Player->m_points));
 
@@ -544,6 +561,11 @@ void cGoldDisplay::Set_Gold(int gold)
     }
 
     pLevel_Player->m_goldpieces = gold;
+
+    if (!Is_Value_Changed(gold)) {
+        return;
+    }
+
     std::string text = int_to_string(pLevel_Player->m_goldpieces);
 
     Color color = Color(static_cast<uint8_t>(255), 255, 255 - (gold * 2));
@@ -586,6 +608,11 @@ void cLiveDisplay::Set_Lives(int lives)
         return;
     }
 
+    // the text also depends on the game mode
+    if (!Is_Value_Changed(static_cast<int64_t>(lives) * 2 + (Game_Mode == MODE_OVERWORLD))) {
+        return;
+    }
+
     std::string text;
 
     // if not in Overworld
@@ -633,12 +660,10 @@ void cTimeDisplay::Update(void)
     const uint32_t seconds = m_milliseconds / 1000;
 
     // update is not needed
-    if (seconds == m_last_update_seconds) {
+    if (!Is_Value_Changed(seconds)) {
         return;
     }
 
-    m_last_update_seconds = seconds;
-
     const uint32_t minutes = seconds / 60;
 
     // Set new time
@@ -659,7 +684,7 @@ void cTimeDisplay::Reset(void)
 {
     // TRANS: HUD Clock is reset to 00:00, the digits are shown a second later for 00:01.
     sprintf(m_clocktext, _("Time"));
-    m_last_update_seconds = 1000;
+    Is_Value_Changed(1000);
     m_milliseconds = 0;
 }
 
@@ -675,6 +700,10 @@ cFpsDisplay::cFpsDisplay()
     : cStatusText()
 {
     sprintf(m_fps_text, "Initialising...");
+
+    for (unsigned int i = 0; i < 5; i++) {
+        m_fps_values[i] = -1;
+    }
 }
 
 cFpsDisplay::~cFpsDisplay()
@@ -685,10 +714,26 @@ void cFpsDisplay::Update(void)
 {
     cStatusText::Update();
 
-    sprintf(m_fps_text, "FPS: best %d worst %d current %d average %u speedfactor %.4f",
-            static_cast<int>(pFramerate->m_fps_best),
-            static_cast<int>(pFramerate->m_fps_worst),
-            static_cast<int>(pFramerate->m_fps),
+    // the values as shown
+    const int values[5] = {
+        static_cast<int>(pFramerate->m_fps_best),
+        static_cast<int>(pFramerate->m_fps_worst),
+        static_cast<int>(pFramerate->m_fps),
+        static_cast<int>(pFramerate->m_fps_average),
+        static_cast<int>(pFramerate->m_speed_factor * 10000.0f + 0.5f)
+    };
+
+    // update is not needed if neither the position nor a value changed
+    if (!Is_Value_Changed(0) && std::equal(values, values + 5, m_fps_values)) {
+        return;
+    }
+
+    std::copy(values, values + 5, m_fps_values);
+
+    snprintf(m_fps_text, sizeof(m_fps_text), "FPS: best %d worst %d current %d average %u speedfactor %.4f",
+            values[0],
+            values[1],
+            values[2],
             pFramerate->m_fps_average,
             pFramerate->m_speed_factor);
 
@@ -98,14 +98,26 @@ namespace TSC {
 
         virtual void Draw();
         virtual void Update();
-        inline void Set_Pos(float x, float y) { m_x = x; m_y = y; }
+        inline void Set_Pos(float x, float y) { m_x = x; m_y = y; m_value_valid = 0; }
 
     protected:
         void Prepare_Text_For_SFML(const std::string&, int fontsize, Color color);
 
+        /* Returns true if the given value differs from the value the
+         * text was last prepared for. Only then the text needs to be
+         * formatted and prepared again.
+        */
+        bool Is_Value_Changed(int64_t value);
+
         sf::Text m_text;
         float m_x;
         float m_y;
+
+    private:
+        // value the text was last prepared for
+        int64_t m_value;
+        // m_value is set and the text is at the current position
+        bool m_value_valid;
     };
 
     /* *** *** *** *** *** cMiniPointsText *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -194,7 +206,6 @@ namespace TSC {
         void Reset(void);
 
         char m_clocktext[50];
-        uint32_t m_last_update_seconds;
         uint32_t m_milliseconds;
     };
 
@@ -209,7 +220,9 @@ namespace TSC {
         virtual void Draw(void);
 
     private:
-        char m_fps_text[5000];
+        char m_fps_text[100];
+        // values the text was last prepared for
+        int m_fps_values[5];
     };
 
     /* *** *** *** *** *** cInfoMessage *** *** *** *** *** *** *** *** *** *** *** */
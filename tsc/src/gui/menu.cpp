@@ -27,6 +27,7 @@
 #include "../overworld/overworld.hpp"
 #include "../user/preferences.hpp"
 #include "../input/keyboard.hpp"
+#include "../input/input_actions.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/filesystem/package_manager.hpp"
 #include "../core/global_basic.hpp"
@@ -263,7 +264,7 @@ bool cMenuCore::Handle_Event(const sf::Event& evt)
 bool cMenuCore::Key_Down(const sf::Event& evt)
 {
     // Down (todo: detect event for joystick better)
-    if (evt.key.code == sf::Keyboard::Down || evt.key.code == pPreferences->m_key_down) {
+    if (evt.key.code == sf::Keyboard::Down || pInput_Actions->Is_Key_Action(evt.key.code, INP_DOWN)) {
         if (m_handler->Get_Size() <= static_cast<unsigned int>(m_handler->m_active + 1)) {
             m_handler->Set_Active(0);
         }
@@ -272,7 +273,7 @@ bool cMenuCore::Key_Down(const sf::Event& evt)
         }
     }
     // Up (todo: detect event for joystick better)
-    else if (evt.key.code == sf::Keyboard::Up || evt.key.code == pPreferences->m_key_up) {
+    else if (evt.key.code == sf::Keyboard::Up || pInput_Actions->Is_Key_Action(evt.key.code, INP_UP)) {
         if (m_handler->m_active <= 0) {
             m_handler->Set_Active(m_handler->Get_Size() - 1);
         }
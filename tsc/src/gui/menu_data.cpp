@@ -510,8 +510,126 @@ void cMenu_Main::Draw(void)
     Draw_End();
 }
 
+/* *** *** *** *** *** *** *** *** cMenu_Level_Catalog *** *** *** *** *** *** *** *** *** */
+
+cMenu_Level_Catalog::cMenu_Level_Catalog(void)
+{
+    m_game_dir_time = 0;
+    m_user_dir_time = 0;
+    m_scan_time = 0;
+}
+
+void cMenu_Level_Catalog::Update(const fs::path& game_dir, const fs::path& user_dir)
+{
+    boost::system::error_code ec;
+    std::time_t game_dir_time = fs::last_write_time(game_dir, ec);
+    if (ec) {
+        game_dir_time = 0;
+    }
+    std::time_t user_dir_time = fs::last_write_time(user_dir, ec);
+    if (ec) {
+        user_dir_time = 0;
+    }
+
+    /* unchanged
+     * The modification times only have a resolution of one second. A
+     * level saved in the same second as the last scan but after it
+     * would keep the time, so only trust times older than the scan.
+    */
+    if (!m_levels.empty() && game_dir == m_game_dir && user_dir == m_user_dir && game_dir_time == m_game_dir_time && user_dir_time == m_user_dir_time
+        && game_dir_time < m_scan_time && user_dir_time < m_scan_time) {
+        return;
+    }
+
+    m_game_dir = game_dir;
+    m_user_dir = user_dir;
+    m_game_dir_time = game_dir_time;
+    m_user_dir_time = user_dir_time;
+    m_scan_time = std::time(NULL);
+
+    m_levels.clear();
+    m_index.clear();
+
+    Add_Directory(game_dir, 0);
+    Add_Directory(user_dir, 1);
+
+    // sort by name like the listbox does
+    std::sort(m_levels.begin(), m_levels.end(), name_sort());
+
+    for (size_t i = 0; i < m_levels.size(); i++) {
+        m_index[m_levels[i].m_name] = i;
+    }
+}
+
+int cMenu_Level_Catalog::Get_Index(const std::string& name) const
+{
+    std::unordered_map<std::string, size_t>::const_iterator itr = m_index.find(name);
+
+    if (itr == m_index.end()) {
+        return -1;
+    }
+
+    return static_cast<int>(itr->second);
+}
+
+void cMenu_Level_Catalog::Add_Directory(const fs::path& dir, bool user)
+{
+    if (!Dir_Exists(dir)) {
+        return;
+    }
+
+    fs::directory_iterator end_iter;
+
+    try {
+        for (fs::directory_iterator dir_itr(dir); dir_itr != end_iter; ++dir_itr) {
+            try {
+                const fs::path this_path = dir_itr->path();
+
+                // .tsclvl is the new TSC level format, but .smclvl is listed for reverse compatibility
+                if (this_path.extension() != fs::path(".tsclvl") && this_path.extension() != fs::path(".smclvl")) {
+                    continue;
+                }
+                if (fs::is_directory(*dir_itr)) {
+                    continue;
+                }
+
+                std::string lvl_name = path_to_utf8(this_path.filename().stem());
+                std::unordered_map<std::string, size_t>::iterator itr = m_index.find(lvl_name);
+
+                // found in both directories
+                if (itr != m_index.end()) {
+                    if (user) {
+                        m_levels[itr->second].m_user = 1;
+                    }
+                    else {
+                        m_levels[itr->second].m_game = 1;
+                    }
+
+                    continue;
+                }
+
+                Level level;
+                level.m_name = lvl_name;
+                level.m_game = !user;
+                level.m_user = user;
+
+                m_index[lvl_name] = m_levels.size();
+                m_levels.push_back(level);
+            }
+            catch (const std::exception& ex) {
+                cerr << dir_itr->path().string().c_str() << " " << ex.what() << endl;
+            }
+        }
+    }
+    catch (const std::exception& ex) {
+        cerr << "Warning : Could not read level directory " << path_to_utf8(dir) << " : " << ex.what() << endl;
+    }
+}
+
 /* *** *** *** *** *** *** *** *** cMenu_Start *** *** *** *** *** *** *** *** *** */
 
+cMenu_Level_Catalog cMenu_Start::m_level_catalog;
+
 cMenu_Start::cMenu_Start(void)
     : cMenu_Base()
 {
@@ -726,48 +844,42 @@ void cMenu_Start::Draw(void)
     Draw_End();
 }
 
-void cMenu_Start::Get_Levels(fs::path dir, CEGUI::Colour color)
+void cMenu_Start::Get_Levels(void)
 {
     CEGUI::Window* p_root = CEGUI::System::getSingleton().getDefaultGUIContext().getRootWindow();
 
     // Level Listbox
     CEGUI::Listbox* listbox_levels = static_cast<CEGUI::Listbox*>(p_root->getChild("menu_overworld/tabcontrol_main/tab_level/listbox_levels"));
 
-    // get all files
-    // .tsclvl is the new TSC level format, but .smclvl is listed for reverse compatibility
-    vector<fs::path> lvl_files = Get_Directory_Files(dir, ".tsclvl", false, false);
-    vector<fs::path> lvl_files2 = Get_Directory_Files(dir, ".smclvl", false, false);
-    lvl_files.insert(lvl_files.end(), lvl_files2.begin(), lvl_files2.end());
+    m_level_catalog.Update(pPackage_Manager->Get_Game_Level_Path(), pPackage_Manager->Get_User_Level_Path());
 
-    // list all available levels
-    for (vector<fs::path>::iterator itr = lvl_files.begin(); itr != lvl_files.end(); ++itr) {
-        // get filename without base directory
-        fs::path lvl_path = (*itr).filename();
+    // the catalog is already sorted, so items can simply be appended
+    listbox_levels->setSortingEnabled(0);
 
-        // erase file extension only if tsclvl or smclvl (reverse compatibilty)
-        if (lvl_path.extension() == fs::path(".tsclvl") || lvl_path.extension() == fs::path(".smclvl"))
-            lvl_path = lvl_path.stem();
+    for (cMenu_Level_Catalog::Level_List::const_iterator itr = m_level_catalog.m_levels.begin(); itr != m_level_catalog.m_levels.end(); ++itr) {
+        const cMenu_Level_Catalog::Level& level = (*itr);
 
-        // create listbox item
-        std::string lvl_name = path_to_utf8(lvl_path);
-        CEGUI::ListboxTextItem* item = new CEGUI::ListboxTextItem(reinterpret_cast<const CEGUI::utf8*>(lvl_name.c_str()));
-        item->setTextColours(color);
-
-        // check if item with the same name already exists
-        CEGUI::ListboxTextItem* item_old = static_cast<CEGUI::ListboxTextItem*>(listbox_levels->findItemWithText(lvl_name, NULL));
-
-        if (item_old) {
+        CEGUI::ListboxTextItem* item = new CEGUI::ListboxTextItem(reinterpret_cast<const CEGUI::utf8*>(level.m_name.c_str()));
+        // is in both
+        if (level.m_game && level.m_user) {
             // mix colors
-            item->setTextColours(item->getTextColours().d_top_left, item->getTextColours().d_top_right, item_old->getTextColours().d_bottom_left, item_old->getTextColours().d_bottom_right);
-            // remove old item
-            listbox_levels->removeItem(item_old);
+            item->setTextColours(CEGUI::Colour(0.8f, 1, 0.6f), CEGUI::Colour(0.8f, 1, 0.6f), CEGUI::Colour(1, 0.8f, 0.6f), CEGUI::Colour(1, 0.8f, 0.6f));
+        }
+        // is in user dir
+        else if (level.m_user) {
+            item->setTextColours(CEGUI::Colour(0.8f, 1, 0.6f));
+        }
+        // is in game dir
+        else {
+            item->setTextColours(CEGUI::Colour(1, 0.8f, 0.6f));
         }
-
 
         item->setSelectionColours(CEGUI::Colour(0.33f, 0.33f, 0.33f));
         item->setSelectionBrushImage("TaharezLook/ListboxSelectionBrush");
         listbox_levels->addItem(item);
     }
+
+    listbox_levels->setSortingEnabled(1);
 }
 
 bool cMenu_Start::Highlight_Level(std::string lvl_name)
@@ -787,7 +899,17 @@ bool cMenu_Start::Highlight_Level(std::string lvl_name)
     // get levels listbox
     CEGUI::Listbox* listbox_levels = static_cast<CEGUI::Listbox*>(p_root->getChild("menu_overworld/tabcontrol_main/tab_level/listbox_levels"));
     // get item
-    CEGUI::ListboxItem* list_item = listbox_levels->findItemWithText(lvl_name, NULL);
+    CEGUI::ListboxItem* list_item = NULL;
+    int index = m_level_catalog.Get_Index(lvl_name);
+
+    if (index >= 0 && static_cast<size_t>(index) < listbox_levels->getItemCount()) {
+        list_item = listbox_levels->getListboxItemFromIndex(index);
+
+        // items were removed since
+        if (list_item->getText() != lvl_name) {
+            list_item = listbox_levels->findItemWithText(lvl_name, NULL);
+        }
+    }
     // select level
     if (list_item) {
         listbox_levels->setItemSelectState(list_item, 1);
@@ -902,8 +1024,8 @@ void cMenu_Start::Load_World(std::string name)
 
     cOverworld* new_world = pOverworld_Manager->Get_from_Name(name);
 
-    // if not available
-    if (!new_world) {
+    // if not available or the world files are broken
+    if (!new_world || !pOverworld_Manager->Load(new_world)) {
         pHud_Debug->Set_Text(_("Couldn't load overworld ") + name, static_cast<float>(speedfactor_fps));
     }
     else {
@@ -1037,10 +1159,8 @@ void cMenu_Start::Update_Lists(void)
     CEGUI::Listbox* listbox_levels = static_cast<CEGUI::Listbox*>(p_root->getChild("menu_overworld/tabcontrol_main/tab_level/listbox_levels"));
     listbox_levels->resetList();
 
-    // get game level
-    Get_Levels(pPackage_Manager->Get_Game_Level_Path(), CEGUI::Colour(1, 0.8f, 0.6f));
-    // get user level
-    Get_Levels(pPackage_Manager->Get_User_Level_Path(), CEGUI::Colour(0.8f, 1, 0.6f));
+    // get game and user level
+    Get_Levels();
 }
 
 bool cMenu_Start::TabControl_Selection_Changed(const CEGUI::EventArgs& e)
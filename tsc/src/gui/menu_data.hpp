@@ -118,6 +118,57 @@ namespace TSC {
         bool m_scaling_up;
     };
 
+    /* *** *** *** *** *** *** *** cMenu_Level_Catalog *** *** *** *** *** *** *** *** *** *** */
+
+    /**
+     * The level names of the game and user level directories shown
+     * in the start menu. It is kept between menu visits and only
+     * read again if one of the directories was modified.
+     */
+    class cMenu_Level_Catalog {
+    public:
+        cMenu_Level_Catalog(void);
+
+        // Read the directories again if they changed
+        void Update(const boost::filesystem::path& game_dir, const boost::filesystem::path& user_dir);
+        // Index of the level in m_levels or -1 if not found
+        int Get_Index(const std::string& name) const;
+
+        struct Level {
+            std::string m_name;
+            // found in the game level directory
+            bool m_game;
+            // found in the user level directory
+            bool m_user;
+        };
+        typedef std::vector<Level> Level_List;
+
+        // levels sorted by name
+        Level_List m_levels;
+
+    private:
+        // Add the levels of the directory
+        void Add_Directory(const boost::filesystem::path& dir, bool user);
+
+        // name sort
+        struct name_sort {
+            bool operator()(const Level& a, const Level& b) const
+            {
+                return a.m_name < b.m_name;
+            }
+        };
+
+        // level name to m_levels index
+        std::unordered_map<std::string, size_t> m_index;
+        // directories and their modification times when last read
+        boost::filesystem::path m_game_dir;
+        boost::filesystem::path m_user_dir;
+        std::time_t m_game_dir_time;
+        std::time_t m_user_dir_time;
+        // when the directories were last read
+        std::time_t m_scan_time;
+    };
+
     /* *** *** *** *** *** *** *** cMenu_Start *** *** *** *** *** *** *** *** *** *** */
 
     /**
@@ -134,8 +185,8 @@ namespace TSC {
         virtual void Update(void);
         virtual void Draw(void);
 
-        // Get all levels from the given directory
-        void Get_Levels(boost::filesystem::path dir, CEGUI::Colour color);
+        // Fill the level listbox from the level catalog
+        void Get_Levels(void);
 
         /* Highlight the given level
          * and activates level tab if needed
@@ -210,6 +261,9 @@ namespace TSC {
         CEGUI::String m_listbox_search_buffer;
         // counter until buffer is cleared
         float m_listbox_search_buffer_counter;
+
+        // game and user levels
+        static cMenu_Level_Catalog m_level_catalog;
     };
 
     /* *** *** *** *** *** *** *** cMenu_Options *** *** *** *** *** *** *** *** *** *** */
@@ -0,0 +1,197 @@
+/***************************************************************************
+ * input_actions.cpp  -  game actions of the keyboard and joystick input
+ *
+ * Copyright © 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/global_basic.hpp"
+#include "../input/input_actions.hpp"
+#include "../input/joystick.hpp"
+#include "../user/preferences.hpp"
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cInput_Actions *** *** *** *** *** *** *** *** *** *** *** */
+
+cInput_Actions::cInput_Actions(void)
+{
+    for (unsigned int i = 0; i <= INP_ITEM; i++) {
+        m_keys[i] = sf::Keyboard::Unknown;
+    }
+
+    for (unsigned int i = 0; i < sf::Keyboard::KeyCount; i++) {
+        m_key_actions[i] = 0;
+    }
+
+    m_injected = 0;
+}
+
+cInput_Actions::~cInput_Actions(void)
+{
+    //
+}
+
+void cInput_Actions::Handle_Event(const sf::Event& evt)
+{
+    /* joystick motion is not handled here as the analog directions
+     * are only updated by cJoystick::Handle_Motion() which reads
+     * the held actions again itself
+    */
+    if (evt.type != sf::Event::KeyPressed && evt.type != sf::Event::KeyReleased && evt.type != sf::Event::JoystickButtonPressed && evt.type != sf::Event::JoystickButtonReleased) {
+        return;
+    }
+
+    Read_Held();
+}
+
+void cInput_Actions::Update(void)
+{
+    Read_Held();
+}
+
+void cInput_Actions::Inject(const cInput_Snapshot& snapshot)
+{
+    m_snapshot = snapshot;
+    m_injected = 1;
+}
+
+void cInput_Actions::Stop_Injection(void)
+{
+    m_injected = 0;
+    Read_Held();
+}
+
+uint32_t cInput_Actions::Get_Key_Actions(sf::Keyboard::Key key)
+{
+    Compile();
+
+    if (key < 0 || key >= sf::Keyboard::KeyCount) {
+        return 0;
+    }
+
+    return m_key_actions[key];
+}
+
+void cInput_Actions::Compile(void)
+{
+    sf::Keyboard::Key keys[INP_ITEM + 1];
+    keys[INP_UNKNOWN] = sf::Keyboard::Unknown;
+    keys[INP_UP] = pPreferences->m_key_up;
+    keys[INP_DOWN] = pPreferences->m_key_down;
+    keys[INP_LEFT] = pPreferences->m_key_left;
+    keys[INP_RIGHT] = pPreferences->m_key_right;
+    keys[INP_JUMP] = pPreferences->m_key_jump;
+    keys[INP_SHOOT] = pPreferences->m_key_shoot;
+    keys[INP_ACTION] = pPreferences->m_key_action;
+    keys[INP_ITEM] = pPreferences->m_key_item;
+
+    // unchanged
+    if (std::equal(keys, keys + INP_ITEM + 1, m_keys)) {
+        return;
+    }
+
+    // remove the old keys
+    for (unsigned int i = INP_UP; i <= INP_ITEM; i++) {
+        if (m_keys[i] >= 0 && m_keys[i] < sf::Keyboard::KeyCount) {
+            m_key_actions[m_keys[i]] = 0;
+        }
+    }
+
+    // add the new keys
+    for (unsigned int i = INP_UP; i <= INP_ITEM; i++) {
+        m_keys[i] = keys[i];
+
+        if (m_keys[i] >= 0 && m_keys[i] < sf::Keyboard::KeyCount) {
+            m_key_actions[m_keys[i]] |= cInput_Snapshot::Action_Bit(static_cast<input_identifier>(i));
+        }
+    }
+}
+
+void cInput_Actions::Read_Held(void)
+{
+    if (m_injected) {
+        return;
+    }
+
+    Compile();
+
+    uint32_t held = 0;
+
+    // keyboard
+    for (unsigned int i = INP_UP; i <= INP_ITEM; i++) {
+        if (m_keys[i] >= 0 && m_keys[i] < sf::Keyboard::KeyCount && sf::Keyboard::isKeyPressed(m_keys[i])) {
+            held |= cInput_Snapshot::Action_Bit(static_cast<input_identifier>(i));
+        }
+    }
+
+    // joystick analog directions
+    if (pJoystick->m_up) {
+        held |= cInput_Snapshot::Action_Bit(INP_UP);
+
+        if (pPreferences->m_joy_analog_jump) {
+            held |= cInput_Snapshot::Action_Bit(INP_JUMP);
+        }
+    }
+    if (pJoystick->m_down) {
+        held |= cInput_Snapshot::Action_Bit(INP_DOWN);
+    }
+    if (pJoystick->m_left) {
+        held |= cInput_Snapshot::Action_Bit(INP_LEFT);
+    }
+    if (pJoystick->m_right) {
+        held |= cInput_Snapshot::Action_Bit(INP_RIGHT);
+    }
+
+    // joystick buttons
+    if (pPreferences->m_joy_enabled) {
+        const uint8_t buttons[] = {pPreferences->m_joy_button_jump, pPreferences->m_joy_button_shoot, pPreferences->m_joy_button_item, pPreferences->m_joy_button_action, pPreferences->m_joy_button_exit};
+
+        for (unsigned int i = 0; i < sizeof(buttons) / sizeof(buttons[0]); i++) {
+            if (sf::Joystick::isButtonPressed(pJoystick->m_current_joystick, buttons[i])) {
+                held |= Get_Button_Actions(buttons[i]);
+            }
+        }
+    }
+
+    m_snapshot.m_held = held;
+}
+
+uint32_t cInput_Actions::Get_Button_Actions(unsigned int button) const
+{
+    uint32_t actions = 0;
+
+    if (button == pPreferences->m_joy_button_jump) {
+        actions |= cInput_Snapshot::Action_Bit(INP_JUMP);
+    }
+    if (button == pPreferences->m_joy_button_shoot) {
+        actions |= cInput_Snapshot::Action_Bit(INP_SHOOT);
+    }
+    if (button == pPreferences->m_joy_button_item) {
+        actions |= cInput_Snapshot::Action_Bit(INP_ITEM);
+    }
+    if (button == pPreferences->m_joy_button_action) {
+        actions |= cInput_Snapshot::Action_Bit(INP_ACTION);
+    }
+    if (button == pPreferences->m_joy_button_exit) {
+        actions |= cInput_Snapshot::Action_Bit(INP_EXIT);
+    }
+
+    return actions;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cInput_Actions* pInput_Actions = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,118 @@
+/***************************************************************************
+ * input_actions.hpp  -  game actions of the keyboard and joystick input
+ *
+ * Copyright © 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_INPUT_ACTIONS_HPP
+#define TSC_INPUT_ACTIONS_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/global_game.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** cInput_Snapshot *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* The held game actions as a bitset
+     * with one bit per input_identifier
+    */
+    class cInput_Snapshot {
+    public:
+        cInput_Snapshot(void)
+            : m_held(0) {};
+
+        // Returns the bit of the given action
+        static inline uint32_t Action_Bit(input_identifier action)
+        {
+            return 1u << action;
+        }
+
+        // check if the action is held down
+        inline bool Held(input_identifier action) const
+        {
+            return (m_held & Action_Bit(action)) != 0;
+        }
+
+        uint32_t m_held;
+    };
+
+    /* *** *** *** *** *** *** cInput_Actions *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Translates the keyboard and joystick input into game actions
+     * using the key and button settings from the preferences.
+     * The keys are compiled into a table of action bits which is
+     * rebuilt automatically when the settings change.
+    */
+    class cInput_Actions {
+    public:
+        cInput_Actions(void);
+        ~cInput_Actions(void);
+
+        /* Handle an input event before it is sent to the handlers
+         * which keeps the snapshot current while handling events
+        */
+        void Handle_Event(const sf::Event& evt);
+        // Take the snapshot for this frame after all events were handled
+        void Update(void);
+        /* Read the held actions from the keyboard and joystick
+         * Called by the joystick when its analog directions changed
+        */
+        void Read_Held(void);
+
+        /* Use the given snapshot instead of the keyboard and joystick
+         * until Stop_Injection() is called
+        */
+        void Inject(const cInput_Snapshot& snapshot);
+        void Stop_Injection(void);
+
+        // Returns the action bits of the given key
+        uint32_t Get_Key_Actions(sf::Keyboard::Key key);
+        // check if the given key triggers the action
+        inline bool Is_Key_Action(sf::Keyboard::Key key, input_identifier action)
+        {
+            return (Get_Key_Actions(key) & cInput_Snapshot::Action_Bit(action)) != 0;
+        }
+
+        // check if the action is held down
+        inline bool Held(input_identifier action) const
+        {
+            return m_snapshot.Held(action);
+        }
+
+        // current state
+        cInput_Snapshot m_snapshot;
+
+    private:
+        // Rebuild the key table if the key settings changed
+        void Compile(void);
+        // Returns the action bits of the given joystick button
+        uint32_t Get_Button_Actions(unsigned int button) const;
+
+        // key settings the table was compiled from
+        sf::Keyboard::Key m_keys[INP_ITEM + 1];
+        // action bits of each key
+        uint32_t m_key_actions[sf::Keyboard::KeyCount];
+        // snapshot is injected
+        bool m_injected;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// global Input Actions pointer
+    extern cInput_Actions* pInput_Actions;
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
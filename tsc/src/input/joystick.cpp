@@ -17,6 +17,7 @@
 #include "../core/global_basic.hpp"
 #include "../input/keyboard.hpp"
 #include "../input/joystick.hpp"
+#include "../input/input_actions.hpp"
 #include "../user/preferences.hpp"
 #include "../core/game_core.hpp"
 #include "../level/level_player.hpp"
@@ -150,8 +151,6 @@ void cJoystick::Reset_keys(void)
 
 void cJoystick::Handle_Motion(const sf::Event& evt)
 {
-    sf::Event newevt;
-
     if (evt.joystickMove.joystickId != m_current_joystick)
         return;
 
@@ -164,17 +163,13 @@ void cJoystick::Handle_Motion(const sf::Event& evt)
             }
 
             if (!m_up) {
-                newevt.type = sf::Event::KeyPressed;
-                newevt.key.code = pPreferences->m_key_up;
-                pKeyboard->Key_Down(newevt);
                 m_up = 1;
+                Send_Key(sf::Event::KeyPressed, pPreferences->m_key_up);
             }
 
             if (m_down) {
-                newevt.type = sf::Event::KeyReleased;
-                newevt.key.code = pPreferences->m_key_down;
-                pKeyboard->Key_Up(newevt);
                 m_down = 0;
+                Send_Key(sf::Event::KeyReleased, pPreferences->m_key_down);
             }
         }
         // Down
@@ -184,33 +179,25 @@ void cJoystick::Handle_Motion(const sf::Event& evt)
             }
 
             if (!m_down) {
-                newevt.type = sf::Event::KeyPressed;
-                newevt.key.code = pPreferences->m_key_down;
-                pKeyboard->Key_Down(newevt);
                 m_down = 1;
+                Send_Key(sf::Event::KeyPressed, pPreferences->m_key_down);
             }
 
             if (m_up) {
-                newevt.type = sf::Event::KeyReleased;
-                newevt.key.code = pPreferences->m_key_up;
-                pKeyboard->Key_Up(newevt);
                 m_up = 0;
+                Send_Key(sf::Event::KeyReleased, pPreferences->m_key_up);
             }
         }
         // No Down/Left
         else {
             if (m_down) {
-                newevt.type = sf::Event::KeyReleased;
-                newevt.key.code = pPreferences->m_key_down;
-                pKeyboard->Key_Up(newevt);
                 m_down = 0;
+                Send_Key(sf::Event::KeyReleased, pPreferences->m_key_down);
             }
 
             if (m_up) {
-                newevt.type = sf::Event::KeyReleased;
-                newevt.key.code = pPreferences->m_key_up;
-                pKeyboard->Key_Up(newevt);
                 m_up = 0;
+                Send_Key(sf::Event::KeyReleased, pPreferences->m_key_up);
             }
         }
     }
@@ -223,17 +210,13 @@ void cJoystick::Handle_Motion(const sf::Event& evt)
             }
 
             if (!m_left) {
-                newevt.type = sf::Event::KeyPressed;
-                newevt.key.code = pPreferences->m_key_left;
-                pKeyboard->Key_Down(newevt);
                 m_left = 1;
+                Send_Key(sf::Event::KeyPressed, pPreferences->m_key_left);
             }
 
             if (m_right) {
-                newevt.type = sf::Event::KeyReleased;
-                newevt.key.code = pPreferences->m_key_right;
-                pKeyboard->Key_Up(newevt);
                 m_right = 0;
+                Send_Key(sf::Event::KeyReleased, pPreferences->m_key_right);
             }
         }
         // Right
@@ -243,38 +226,49 @@ void cJoystick::Handle_Motion(const sf::Event& evt)
             }
 
             if (!m_right) {
-                newevt.type = sf::Event::KeyPressed;
-                newevt.key.code = pPreferences->m_key_right;
-                pKeyboard->Key_Down(newevt);
                 m_right = 1;
+                Send_Key(sf::Event::KeyPressed, pPreferences->m_key_right);
             }
 
             if (m_left) {
-                newevt.type = sf::Event::KeyReleased;
-                newevt.key.code = pPreferences->m_key_left;
-                pKeyboard->Key_Up(newevt);
                 m_left = 0;
+                Send_Key(sf::Event::KeyReleased, pPreferences->m_key_left);
             }
         }
         // No Left/Right
         else {
             if (m_left) {
-                newevt.type = sf::Event::KeyReleased;
-                newevt.key.code = pPreferences->m_key_left;
-                pKeyboard->Key_Up(newevt);
                 m_left = 0;
+                Send_Key(sf::Event::KeyReleased, pPreferences->m_key_left);
             }
 
             if (m_right) {
-                newevt.type = sf::Event::KeyReleased;
-                newevt.key.code = pPreferences->m_key_right;
-                pKeyboard->Key_Up(newevt);
                 m_right = 0;
+                Send_Key(sf::Event::KeyReleased, pPreferences->m_key_right);
             }
         }
     }
 }
 
+void cJoystick::Send_Key(sf::Event::EventType type, sf::Keyboard::Key key)
+{
+    // the handlers check the held game actions
+    if (pInput_Actions) {
+        pInput_Actions->Read_Held();
+    }
+
+    sf::Event newevt;
+    newevt.type = type;
+    newevt.key.code = key;
+
+    if (type == sf::Event::KeyPressed) {
+        pKeyboard->Key_Down(newevt);
+    }
+    else {
+        pKeyboard->Key_Up(newevt);
+    }
+}
+
 bool cJoystick::Handle_Button_Down_Event(const sf::Event& evt)
 {
     // not enabled or opened
@@ -77,6 +77,10 @@ namespace TSC {
 
         // if true print debug output
         bool m_debug;
+
+    private:
+        // Send the key event of an analog direction to the keyboard handler
+        void Send_Key(sf::Event::EventType type, sf::Keyboard::Key key);
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -190,7 +190,7 @@ bool cLevel::New(std::string levelname)
     return 0;
 }
 
-cLevel* cLevel::Load_From_File(fs::path filename)
+bool cLevel::Check_Level_File(const fs::path& filename)
 {
     if (filename.empty())
         throw(InvalidLevelError("Empty level filename!"));
@@ -199,30 +199,26 @@ cLevel* cLevel::Load_From_File(fs::path filename)
         throw (InvalidLevelError(msg));
     }
 
-    // This is our loader
-    cLevelLoader loader;
-
-    // supported level format
-    if (filename.extension() == fs::path(".tsclvl")  || filename.extension() == fs::path(".smclvl")) {
-        loader.parse_file(filename);
-    }
-    else { // old, unsupported level format
+    // old, unsupported level format
+    if (filename.extension() != fs::path(".tsclvl") && filename.extension() != fs::path(".smclvl")) {
         pHud_Debug->Set_Text(_("Unsupported Level format : ") + (const std::string)path_to_utf8(filename));
-        return NULL;
+        return 0;
     }
 
-    // Our level
-    cLevel* p_level = loader.Get_Level();
+    return 1;
+}
 
-    // FIXME: Move this into cLevelLoader::on_end_document()
-    /* late initialization
-     * needed to create links to other objects
-    */
-    for (cSprite_List::iterator itr = p_level->m_sprite_manager->objects.begin(); itr != p_level->m_sprite_manager->objects.end(); ++itr) {
-        cSprite* obj = (*itr);
+cLevel* cLevel::Load_From_File(fs::path filename)
+{
+    if (!Check_Level_File(filename))
+        return NULL;
 
-        obj->Init_Links();
-    }
+    // This is our loader
+    cLevelLoader loader;
+    loader.parse_file(filename);
+
+    // Our level
+    cLevel* p_level = loader.Get_Level();
 
     debug_print("Loaded level: %s\n", path_to_utf8(p_level->m_level_filename).c_str());
 
@@ -537,6 +533,9 @@ void cLevel::Enter(const GameMode old_mode /* = MODE_NOTHING */)
         cerr << "Warning : Music file not found: " << path_to_utf8(pActive_Level->m_musicfile) << endl;
     }
 
+    // load the levels which can be entered from here in the background
+    pLevel_Manager->Prefetch_Neighbours(this);
+
     // Update Hud Text and position
     pHud_Manager->Update_Text();
 
@@ -994,6 +993,11 @@ void cLevel::Set_Filename(fs::path filename, bool rename_old /* = true */)
     }
 
     m_level_filename = filename;
+
+    // the level name changed
+    if (pLevel_Manager) {
+        pLevel_Manager->Update_Index();
+    }
 }
 
 void cLevel::Set_Author(const std::string& name)
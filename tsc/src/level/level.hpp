@@ -35,6 +35,11 @@ namespace TSC {
 
         /// Loads a level from the given file.
         static cLevel* Load_From_File(boost::filesystem::path filename);
+        /* Check if the given file can be loaded as a level.
+         * Throws InvalidLevelError if it does not exist and
+         * returns false if the file format is not supported.
+        */
+        static bool Check_Level_File(const boost::filesystem::path& filename);
 
         cLevel(void);
         virtual ~cLevel(void);
@@ -52,6 +52,7 @@
 #include "../objects/ball.hpp"
 #include "../objects/lava.hpp"
 #include "../objects/crate.hpp"
+#include "../core/errors.hpp"
 #include "../core/global_basic.hpp"
 
 namespace fs = boost::filesystem;
@@ -64,6 +65,8 @@ cLevelLoader::cLevelLoader()
 {
     mp_level    = NULL;
     m_in_script_tag = false;
+    m_parsed = false;
+    m_next_record = 0;
 }
 
 cLevelLoader::~cLevelLoader()
@@ -78,32 +81,102 @@ cLevel* cLevelLoader::Get_Level()
     return mp_level;
 }
 
-/***************************************
- * SAX parser callbacks
- ***************************************/
+const std::vector<cLevel_Loader_Record>& cLevelLoader::Get_Records() const
+{
+    return m_records;
+}
+
+float cLevelLoader::Get_Build_Progress() const
+{
+    if (m_records.empty())
+        return mp_level ? 1.0f : 0.0f;
+
+    return static_cast<float>(m_next_record) / static_cast<float>(m_records.size());
+}
 
 void cLevelLoader::parse_file(boost::filesystem::path filename)
+{
+    Parse_Records(filename);
+    Build_Level();
+}
+
+void cLevelLoader::Parse_Records(boost::filesystem::path filename, boost::function<bool (void)> is_canceled /* = boost::function<bool (void)>() */)
 {
     m_levelfile = filename;
+    m_is_canceled = is_canceled;
     xmlpp::SaxParser::parse_file(path_to_utf8(filename));
+    m_is_canceled.clear();
+    m_parsed = true;
 }
 
-void cLevelLoader::on_start_document()
+bool cLevelLoader::Build_Level(unsigned int budget_ms /* = 0 */)
 {
-    if (mp_level)
-        throw("Restarted XML parser after already starting it."); // FIXME: proper exception
+    uint32_t start_ticks = TSC_GetTicks();
 
-    mp_level = new cLevel();
-    m_in_script_tag = false;
-}
+    if (!mp_level) {
+        mp_level = new cLevel();
+        mp_level->m_script = m_script;
+    }
+
+    while (m_next_record < m_records.size()) {
+        cLevel_Loader_Record& record = m_records[m_next_record];
+        m_next_record++;
+
+        // the handlers below work on the current properties
+        m_current_properties.swap(record.m_attributes);
+
+        // Now for the real, cumbersome parsing process
+        if (record.m_name == "information")
+            Parse_Tag_Information();
+        else if (record.m_name == "settings")
+            Parse_Tag_Settings();
+        else if (record.m_name == "background")
+            Parse_Tag_Background();
+        else if (record.m_name == "player")
+            Parse_Tag_Player();
+        else
+            Parse_Level_Object_Tag(record.m_name);
+
+        m_current_properties.clear();
+
+        // out of time for this frame
+        if (budget_ms && TSC_GetTicks() - start_ticks >= budget_ms && m_next_record < m_records.size())
+            return false;
+    }
 
-void cLevelLoader::on_end_document()
-{
     mp_level->m_level_filename = m_levelfile;
 
     // engine version entry not set
     if (mp_level->m_engine_version < 0)
         mp_level->m_engine_version = 0;
+
+    /* late initialization
+     * needed to create links to other objects
+    */
+    for (cSprite_List::iterator itr = mp_level->m_sprite_manager->objects.begin(); itr != mp_level->m_sprite_manager->objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        obj->Init_Links();
+    }
+
+    return true;
+}
+
+/***************************************
+ * SAX parser callbacks
+ ***************************************/
+
+void cLevelLoader::on_start_document()
+{
+    if (m_parsed)
+        throw(RestartedXmlParserError());
+
+    m_in_script_tag = false;
+}
+
+void cLevelLoader::on_end_document()
+{
+    //
 }
 
 void cLevelLoader::on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties)
@@ -117,15 +190,16 @@ void cLevelLoader::on_start_element(const Glib::ustring& name, const xmlpp::SaxP
          * surrounding element is closed, the results are handled
          * in on_end_element(). */
         for (xmlpp::SaxParser::AttributeList::const_iterator iter = properties.begin(); iter != properties.end(); iter++) {
-            xmlpp::SaxParser::Attribute attr = *iter;
+            // no copy of the attribute strings
+            const xmlpp::SaxParser::Attribute& attr = *iter;
 
             if (attr.name == "name")
-                key = attr.value;
+                key = attr.value.raw();
             else if (attr.name == "value")
-                value = attr.value;
+                value = attr.value.raw();
         }
 
-        m_current_properties[key] = value;
+        m_current_properties[key].swap(value);
     }
     else if (name == "script") {
         // Indicate a script tag has opened, so we can retrieve
@@ -142,17 +216,18 @@ void cLevelLoader::on_end_element(const Glib::ustring& name)
     if (name == "property" || name == "Property")
         return;
 
-    // Now for the real, cumbersome parsing process
-    if (name == "information")
-        Parse_Tag_Information();
-    else if (name == "settings")
-        Parse_Tag_Settings();
-    else if (name == "background")
-        Parse_Tag_Background();
-    else if (name == "player")
-        Parse_Tag_Player();
-    else if (cLevel::Is_Level_Object_Element(std::string(name))) // CEGUI doesn’t like Glib::ustring
-        Parse_Level_Object_Tag(name);
+    /* Remember the major elements for Build_Level(). Nothing is
+     * created here as this may run outside the main thread. */
+    if (cLevel::Is_Level_Object_Element(std::string(name))) { // CEGUI doesn’t like Glib::ustring
+        m_records.push_back(cLevel_Loader_Record());
+        m_records.back().m_name = name;
+        m_records.back().m_attributes.swap(m_current_properties);
+
+        /* The SAX parser stops on an xmlpp::exception from a callback
+         * and throws it again from parse_file(). */
+        if (m_is_canceled && m_is_canceled())
+            throw xmlpp::exception("Level parsing was canceled: " + path_to_utf8(m_levelfile));
+    }
     else if (name == "level") {
         /* Ignore the root <level> tag */
     }
@@ -173,7 +248,7 @@ void cLevelLoader::on_characters(const Glib::ustring& text)
      * text (may be called multiple times for each token,
      * so append rather then set directly). */
     if (m_in_script_tag)
-        mp_level->m_script.append(text);
+        m_script.append(text);
 }
 
 /***************************************
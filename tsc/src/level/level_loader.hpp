@@ -18,9 +18,19 @@
 #include "../core/global_game.hpp"
 #include "../core/xml_attributes.hpp"
 #include "level.hpp"
+#include <boost/function.hpp>
 
 namespace TSC {
 
+    /**
+     * A mayor level XML element (like <sprite> or <settings>) together
+     * with all the <property> values found below it.
+     */
+    struct cLevel_Loader_Record {
+        std::string m_name;
+        XmlAttributes m_attributes;
+    };
+
     /**
      * This class is used to construct a level from a given XML file.
      * While technically all its code could be included in cLevel directly,
@@ -37,6 +47,13 @@ namespace TSC {
      * Note that the cLevel instance returned by Get_Level() is NOT destroyed
      * when the cLevelLoader gets destroyed. It is handed to you for further
      * processing instead.
+     *
+     * Loading happens in two steps. Parse_Records() only reads the XML
+     * into a list of cLevel_Loader_Record instances and does not touch
+     * OpenGL, the sprite managers or any other global game state, so it
+     * may run in a worker thread (see cLevel_Loading_Job). Build_Level()
+     * then creates the cLevel and its objects from these records and
+     * must be called from the main thread. parse_file() does both at once.
      */
     class cLevelLoader: public xmlpp::SaxParser {
     public:
@@ -56,6 +73,21 @@ namespace TSC {
         // parse_file() that accepts a Glib::ustring — this function sets
         // some internal members.
         virtual void parse_file(boost::filesystem::path filename);
+        /* Parse the given filename into records only. Thread-safe.
+         * is_canceled : checked after each record, parsing stops
+         * with an xmlpp::exception once it returns true
+        */
+        void Parse_Records(boost::filesystem::path filename, boost::function<bool (void)> is_canceled = boost::function<bool (void)>());
+        /* Create the level and its objects from the parsed records.
+         * budget_ms : return after about this many milliseconds even if
+         * not all records were handled yet (0 = no limit)
+         * Returns true once the level is complete.
+        */
+        bool Build_Level(unsigned int budget_ms = 0);
+        // Return the build progress (range 0.0-1.0)
+        float Get_Build_Progress() const;
+        // Return the parsed records
+        const std::vector<cLevel_Loader_Record>& Get_Records() const;
         // After finishing parsing, contains a pointer to a cLevel instance.
         // This pointer must be freed by you. Returns NULL before parsing.
         cLevel* Get_Level();
@@ -101,6 +133,16 @@ namespace TSC {
         XmlAttributes m_current_properties;
         // True if we’re currently parsing a <script> tag.
         bool m_in_script_tag;
+        // True once the XML file has been read
+        bool m_parsed;
+        // All mayor elements in document order
+        std::vector<cLevel_Loader_Record> m_records;
+        // The next record Build_Level() handles
+        size_t m_next_record;
+        // Returns true if Parse_Records() should stop
+        boost::function<bool (void)> m_is_canceled;
+        // Contents of the <script> tag
+        std::string m_script;
     };
 
 }
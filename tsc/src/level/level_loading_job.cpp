@@ -0,0 +1,438 @@
+/***************************************************************************
+ * level_loading_job.cpp - loading levels in the background
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "level_loading_job.hpp"
+#include "level.hpp"
+#include "../core/game_core.hpp"
+#include "../core/errors.hpp"
+#include "../core/i18n.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/filesystem/package_manager.hpp"
+#include "../video/img_manager.hpp"
+#include "../video/loading_screen.hpp"
+#include "../video/texture_cache.hpp"
+#include "../audio/audio.hpp"
+#include "../core/global_basic.hpp"
+#include <boost/bind.hpp>
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** cLevel_Loading_Job *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cLevel_Loading_Job::cLevel_Loading_Job(const fs::path& filename)
+{
+    m_filename = filename;
+
+    m_started = 0;
+    m_prepared = 0;
+    m_canceled = 0;
+    m_finished = 0;
+    m_level_taken = 0;
+    m_prepare_progress = 0.0f;
+    m_sound_enabled = 0;
+}
+
+cLevel_Loading_Job::~cLevel_Loading_Job(void)
+{
+    Cancel();
+    Wait();
+
+    // sounds not handed to the sound manager
+    for (SoundList::iterator itr = m_sounds.begin(); itr != m_sounds.end(); ++itr) {
+        delete *itr;
+    }
+
+    // images not used by the level
+    for (vector<cPreloaded_Image>::iterator itr = m_preloaded_images.begin(); itr != m_preloaded_images.end(); ++itr) {
+        pImage_Manager->Delete_Preloaded_Image(itr->m_path, itr->m_image);
+    }
+
+    // level not handed out
+    if (!m_level_taken) {
+        delete m_loader.Get_Level();
+    }
+}
+
+void cLevel_Loading_Job::Start(void)
+{
+    if (m_started) {
+        return;
+    }
+
+    // remember what is already loaded as the managers are not thread-safe
+    for (GL_Surface_List::iterator itr = pImage_Manager->objects.begin(); itr != pImage_Manager->objects.end(); ++itr) {
+        m_loaded_images.insert((*itr)->m_path);
+    }
+
+    m_sound_enabled = pAudio->m_initialised && pAudio->m_sound_enabled;
+
+    if (m_sound_enabled) {
+        for (SoundList::iterator itr = pSound_Manager->objects.begin(); itr != pSound_Manager->objects.end(); ++itr) {
+            m_loaded_sounds.insert((*itr)->m_filename);
+        }
+    }
+
+    m_started = 1;
+    m_thread = boost::thread(&cLevel_Loading_Job::Prepare, this);
+}
+
+bool cLevel_Loading_Job::Is_Prepared(void)
+{
+    boost::mutex::scoped_lock lock(m_mutex);
+
+    return m_prepared;
+}
+
+void cLevel_Loading_Job::Wait(void)
+{
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void cLevel_Loading_Job::Cancel(void)
+{
+    boost::mutex::scoped_lock lock(m_mutex);
+
+    m_canceled = 1;
+}
+
+bool cLevel_Loading_Job::Is_Canceled(void)
+{
+    boost::mutex::scoped_lock lock(m_mutex);
+
+    return m_canceled;
+}
+
+bool cLevel_Loading_Job::Finish(unsigned int budget_ms /* = 0 */)
+{
+    if (m_finished) {
+        return 1;
+    }
+
+    if (!m_started) {
+        Start();
+    }
+
+    Wait();
+
+    if (!m_error.empty()) {
+        throw(InvalidLevelError(m_error));
+    }
+
+    if (m_canceled) {
+        throw(InvalidLevelError("Level loading was canceled: " + path_to_utf8(m_filename)));
+    }
+
+    // hand the decoded sounds to the sound manager
+    for (SoundList::iterator itr = m_sounds.begin(); itr != m_sounds.end(); ++itr) {
+        cSound* sound = (*itr);
+
+        // loaded in the meantime
+        if (pSound_Manager->Get_Pointer(sound->m_filename)) {
+            delete sound;
+            continue;
+        }
+
+        pSound_Manager->Add(sound);
+    }
+
+    m_sounds.clear();
+
+    // create the level objects
+    if (!m_loader.Build_Level(budget_ms)) {
+        return 0;
+    }
+
+    m_finished = 1;
+    debug_print("Loaded level: %s\n", path_to_utf8(m_filename).c_str());
+
+    return 1;
+}
+
+bool cLevel_Loading_Job::Is_Finished(void) const
+{
+    return m_finished;
+}
+
+float cLevel_Loading_Job::Get_Progress(void)
+{
+    // the worker thread is about as expensive as the main thread part
+    if (!Is_Prepared()) {
+        boost::mutex::scoped_lock lock(m_mutex);
+        return m_prepare_progress * 0.5f;
+    }
+
+    return 0.5f + (m_loader.Get_Build_Progress() * 0.5f);
+}
+
+size_t cLevel_Loading_Job::Get_Memory_Usage(void)
+{
+    boost::mutex::scoped_lock lock(m_mutex);
+    size_t memory = 0;
+
+    // sounds not yet handed to the sound manager
+    for (SoundList::iterator itr = m_sounds.begin(); itr != m_sounds.end(); ++itr) {
+        memory += (*itr)->m_buffer.getSampleCount() * sizeof(sf::Int16);
+    }
+
+    // images not yet taken by a level
+    for (vector<cPreloaded_Image>::iterator itr = m_preloaded_images.begin(); itr != m_preloaded_images.end(); ++itr) {
+        if (pImage_Manager->Has_Preloaded_Image(itr->m_path, itr->m_image)) {
+            memory += itr->m_memory_usage;
+        }
+    }
+
+    return memory;
+}
+
+std::string cLevel_Loading_Job::Get_Level_Name(void) const
+{
+    return path_to_utf8(Trim_Filename(m_filename, false, false));
+}
+
+cLevel* cLevel_Loading_Job::Get_Level(void)
+{
+    if (!m_finished) {
+        return NULL;
+    }
+
+    m_level_taken = 1;
+    return m_loader.Get_Level();
+}
+
+cLevel* cLevel_Loading_Job::Run(void)
+{
+    Start();
+
+    const uint32_t start_ticks = TSC_GetTicks();
+    bool loading_screen = 0;
+
+    try {
+        while (!Is_Prepared() || !Finish(m_frame_budget_ms)) {
+            // only show the loading screen if it is noticeable
+            if (!loading_screen && TSC_GetTicks() - start_ticks >= m_loading_screen_delay) {
+                Loading_Screen_Init();
+                Loading_Screen_Draw_Text(_("Loading Level"));
+                loading_screen = 1;
+            }
+
+            if (loading_screen) {
+                Update_Loading_Screen();
+            }
+            // let the worker thread do its work
+            else if (!Is_Prepared()) {
+                boost::this_thread::sleep_for(boost::chrono::milliseconds(2));
+            }
+        }
+    }
+    catch (...) {
+        if (loading_screen) {
+            Loading_Screen_Exit();
+        }
+
+        throw;
+    }
+
+    if (loading_screen) {
+        Loading_Screen_Exit();
+    }
+
+    return Get_Level();
+}
+
+void cLevel_Loading_Job::Prepare(void)
+{
+    // nothing may be thrown out of the thread function
+    try {
+        m_loader.Parse_Records(m_filename, boost::bind(&cLevel_Loading_Job::Is_Canceled, this));
+        Preload_Records();
+    }
+    catch (const xmlpp::exception& ex) {
+        boost::mutex::scoped_lock lock(m_mutex);
+        m_error = "Failed to parse level file " + path_to_utf8(m_filename) + ": " + ex.what();
+        m_prepared = 1;
+        return;
+    }
+    catch (const std::exception& ex) {
+        boost::mutex::scoped_lock lock(m_mutex);
+        m_error = ex.what();
+        m_prepared = 1;
+        return;
+    }
+    catch (...) {
+        boost::mutex::scoped_lock lock(m_mutex);
+        m_error = "Failed to load level file " + path_to_utf8(m_filename);
+        m_prepared = 1;
+        return;
+    }
+
+    boost::mutex::scoped_lock lock(m_mutex);
+    m_prepare_progress = 1.0f;
+    m_prepared = 1;
+}
+
+void cLevel_Loading_Job::Preload_Records(void)
+{
+    const vector<cLevel_Loader_Record>& records = m_loader.Get_Records();
+    size_t count = 0;
+
+    for (vector<cLevel_Loader_Record>::const_iterator itr = records.begin(); itr != records.end(); ++itr) {
+        const cLevel_Loader_Record& record = (*itr);
+
+        XmlAttributes::const_iterator attr = record.m_attributes.find("image");
+
+        if (attr != record.m_attributes.end()) {
+            Preload_Image(attr->second);
+        }
+
+        if (record.m_name == "sound") {
+            attr = record.m_attributes.find("file");
+
+            if (attr != record.m_attributes.end()) {
+                Preload_Sound(attr->second);
+            }
+        }
+
+        count++;
+
+        boost::mutex::scoped_lock lock(m_mutex);
+        m_prepare_progress = static_cast<float>(count) / static_cast<float>(records.size());
+
+        if (m_canceled) {
+            break;
+        }
+    }
+}
+
+void cLevel_Loading_Job::Preload_Image(const std::string& image)
+{
+    if (image.empty()) {
+        return;
+    }
+
+    // resolve the same way as cVideo::Get_Package_Surface()
+    fs::path filename = pPackage_Manager->Get_Pixmap_Reading_Path(image, true);
+
+    if (filename.extension() == fs::path(".settings")) {
+        filename.replace_extension(".png");
+    }
+
+    // only plain images and no image sets
+    if (filename.extension() != fs::path(".png")) {
+        return;
+    }
+
+    // already loaded or preloaded
+    if (m_loaded_images.count(filename) || pImage_Manager->Has_Preloaded_Image(filename)) {
+        return;
+    }
+
+    // only try each image once
+    m_loaded_images.insert(filename);
+
+    // the decoded texture cache is faster than decoding again
+    fs::path texture_cache_filename = pVideo->Get_Texture_Cache_Filename(filename);
+
+    if (!texture_cache_filename.empty()) {
+        fs::path settings_filename = filename;
+        settings_filename.replace_extension(".settings");
+
+        cTexture_Cache_File cache_file;
+
+        if (cache_file.Open(texture_cache_filename) && cache_file.Is_Current(settings_filename)) {
+            return;
+        }
+    }
+
+    cVideo::cSoftware_Image software_image = pVideo->Load_Package_Image(filename, 1, 0);
+
+    if (!software_image.m_sf_image) {
+        return;
+    }
+
+    const sf::Vector2u size = software_image.m_sf_image->getSize();
+
+    cPreloaded_Image preloaded;
+    preloaded.m_path = filename;
+    preloaded.m_image = software_image.m_sf_image;
+    preloaded.m_memory_usage = size.x * size.y * 4;
+
+    // another job was faster and the image is not ours
+    if (!pImage_Manager->Add_Preloaded_Image(filename, software_image)) {
+        return;
+    }
+
+    boost::mutex::scoped_lock lock(m_mutex);
+    m_preloaded_images.push_back(preloaded);
+}
+
+void cLevel_Loading_Job::Preload_Sound(const std::string& sound)
+{
+    if (!m_sound_enabled || sound.empty()) {
+        return;
+    }
+
+    // resolve the same way as cAudio::Play_Sound()
+    fs::path filename = utf8_to_path(sound);
+
+    if (!File_Exists(filename) && !filename.is_absolute()) {
+        filename = pPackage_Manager->Get_Sound_Reading_Path(sound);
+    }
+
+    // already loaded
+    if (m_loaded_sounds.count(filename)) {
+        return;
+    }
+
+    // only try each sound once
+    m_loaded_sounds.insert(filename);
+
+    cSound* sound_data = new cSound();
+
+    if (!sound_data->Load(filename)) {
+        delete sound_data;
+        return;
+    }
+
+    boost::mutex::scoped_lock lock(m_mutex);
+    m_sounds.push_back(sound_data);
+}
+
+void cLevel_Loading_Job::Update_Loading_Screen(void)
+{
+    // keep the window responsive but ignore input while loading
+    sf::Event ev;
+
+    while (pVideo->mp_window->pollEvent(ev)) {
+        if (ev.type == sf::Event::Closed) {
+            game_exit = 1;
+        }
+    }
+
+    // keep the music going
+    pAudio->Update();
+
+    Loading_Screen_Set_Progress(Get_Progress());
+    Loading_Screen_Draw();
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,160 @@
+/***************************************************************************
+ * level_loading_job.hpp - loading levels in the background
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_LEVEL_LOADING_JOB_HPP
+#define TSC_LEVEL_LOADING_JOB_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/global_game.hpp"
+#include "../audio/sound_manager.hpp"
+#include "level_loader.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cLevel_Loading_Job *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /**
+     * Loads a level in two phases so the game does not freeze while
+     * doing so.
+     *
+     * The first phase runs in a worker thread started with Start(). It
+     * parses the level XML (see cLevelLoader::Parse_Records()), decodes
+     * the images referenced by the level objects into software images
+     * handed to cImage_Manager::Add_Preloaded_Image() and decodes the
+     * sound buffers of the level sounds.
+     *
+     * The second phase must run in the main thread. Finish() uploads
+     * the textures, creates the level objects and adds them to the
+     * sprite manager. It can be limited to a time budget so it may be
+     * spread over several frames.
+     *
+     * Run() does all of this and shows the loading screen with the
+     * real progress if loading takes a noticeable time.
+     */
+    class cLevel_Loading_Job {
+    public:
+        // filename : the full path to the level file
+        cLevel_Loading_Job(const boost::filesystem::path& filename);
+        // Waits for the worker thread. Deletes the level if it was not taken.
+        ~cLevel_Loading_Job(void);
+
+        // Start the worker thread. Main thread only.
+        void Start(void);
+        // Return true if the worker thread is done
+        bool Is_Prepared(void);
+        // Wait until the worker thread is done
+        void Wait(void);
+        /* Tell the worker thread to stop decoding
+         * The job can not be finished afterwards.
+        */
+        void Cancel(void);
+
+        /* Create the level from the prepared data. Main thread only.
+         * Waits for the worker thread if it is not done yet.
+         * budget_ms : return after about this many milliseconds (0 = no limit)
+         * Returns true once the level is complete.
+         * Throws InvalidLevelError if the level file could not be parsed.
+        */
+        bool Finish(unsigned int budget_ms = 0);
+        // Return true if Finish() completed the level
+        bool Is_Finished(void) const;
+
+        // Return the overall loading progress (range 0.0-1.0)
+        float Get_Progress(void);
+        // Return the approximate memory in bytes used by the decoded data not yet used
+        size_t Get_Memory_Usage(void);
+        // Return the level name
+        std::string Get_Level_Name(void) const;
+
+        /* Return the loaded level or NULL if not finished
+         * The level must be freed by you.
+        */
+        cLevel* Get_Level(void);
+
+        /* Load the level with all steps and return it
+         * Shows the loading screen if loading takes longer than m_loading_screen_delay.
+         * Throws InvalidLevelError if the level file could not be parsed.
+        */
+        cLevel* Run(void);
+
+        // level filename
+        boost::filesystem::path m_filename;
+
+        // maximum main thread time in milliseconds Run() uses between two loading screen frames
+        static const unsigned int m_frame_budget_ms = 12;
+        // time in milliseconds after which Run() shows the loading screen
+        static const unsigned int m_loading_screen_delay = 150;
+
+    private:
+        // Worker thread function
+        void Prepare(void);
+        // Return true if Cancel() was called
+        bool Is_Canceled(void);
+        // Decode the images and sounds of the parsed records. Worker thread only.
+        void Preload_Records(void);
+        // Decode the given image if not already loaded. Worker thread only.
+        void Preload_Image(const std::string& image);
+        // Decode the given sound if not already loaded. Worker thread only.
+        void Preload_Sound(const std::string& sound);
+        // Draw the loading screen and keep window and audio responsive
+        void Update_Loading_Screen(void);
+
+        // the loader holding the parsed level data
+        cLevelLoader m_loader;
+        // worker thread
+        boost::thread m_thread;
+        // guards the data shared with the worker thread
+        boost::mutex m_mutex;
+
+        // worker thread is running
+        bool m_started;
+        // worker thread is done
+        bool m_prepared;
+        // worker thread should stop
+        bool m_canceled;
+        // Finish() completed the level
+        bool m_finished;
+        // Get_Level() handed out the level
+        bool m_level_taken;
+        // worker thread error message
+        std::string m_error;
+        // worker thread progress (range 0.0-1.0)
+        float m_prepare_progress;
+
+        // images and sounds already loaded when the job was started
+        std::set<boost::filesystem::path> m_loaded_images;
+        std::set<boost::filesystem::path> m_loaded_sounds;
+        // an image handed to the image manager by this job
+        struct cPreloaded_Image {
+            boost::filesystem::path m_path;
+            // only used to tell if it is still ours
+            const sf::Image* m_image;
+            // decoded size in bytes
+            size_t m_memory_usage;
+        };
+
+        // images preloaded by this job
+        std::vector<cPreloaded_Image> m_preloaded_images;
+        // sounds decoded by the worker thread
+        SoundList m_sounds;
+        // sounds can be used
+        bool m_sound_enabled;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -21,6 +21,10 @@
 #include "../core/i18n.hpp"
 #include "../core/errors.hpp"
 #include "../overworld/overworld.hpp"
+#include "../overworld/world_player.hpp"
+#include "../overworld/world_layer.hpp"
+#include "../objects/level_exit.hpp"
+#include "../user/preferences.hpp"
 #include "../core/framerate.hpp"
 #include "../objects/path.hpp"
 #include "../audio/audio.hpp"
@@ -58,10 +62,37 @@ cLevel_Manager::cLevel_Manager(void)
 
 cLevel_Manager::~cLevel_Manager(void)
 {
+    Clear_Prefetched();
     Delete_All();
     delete m_camera;
 }
 
+void cLevel_Manager::Add(cLevel* level)
+{
+    cObject_Manager<cLevel>::Add(level);
+    m_level_index[level->Get_Level_Name()] = level;
+}
+
+bool cLevel_Manager::Delete(size_t array_num, bool delete_data /* = 1 */)
+{
+    bool result = cObject_Manager<cLevel>::Delete(array_num, delete_data);
+    Update_Index();
+    return result;
+}
+
+bool cLevel_Manager::Delete(cLevel* level, bool delete_data /* = 1 */)
+{
+    bool result = cObject_Manager<cLevel>::Delete(level, delete_data);
+    Update_Index();
+    return result;
+}
+
+void cLevel_Manager::Delete_All(void)
+{
+    cObject_Manager<cLevel>::Delete_All();
+    m_level_index.clear();
+}
+
 void cLevel_Manager::Init(void)
 {
 
@@ -82,6 +113,7 @@ void cLevel_Manager::Unload(void)
         }
 
         pActive_Level = objects.front();
+        Update_Index();
     }
 
     // keep the managers valid
@@ -131,7 +163,45 @@ cLevel* cLevel_Manager::Load(std::string levelname , bool loading_sublevel /* =
 
     // load
     fs::path filename = Get_Path(levelname);
-    level = cLevel::Load_From_File(filename);
+
+    if (!cLevel::Check_Level_File(filename)) {
+        return NULL;
+    }
+
+    // prefetched
+    for (Level_Loading_Job_List::iterator itr = m_prefetch_jobs.begin(); itr != m_prefetch_jobs.end(); ++itr) {
+        cLevel_Loading_Job* job = (*itr);
+
+        if (job->Get_Level_Name().compare(levelname) != 0) {
+            continue;
+        }
+
+        m_prefetch_jobs.erase(itr);
+
+        // the file was replaced, for example by a user level
+        if (job->m_filename != filename) {
+            delete job;
+            break;
+        }
+
+        try {
+            job->Finish();
+        }
+        catch (InvalidLevelError&) {
+            delete job;
+            throw;
+        }
+
+        level = job->Get_Level();
+        delete job;
+
+        Add(level);
+        return level;
+    }
+
+    // parse and decode in the background while the main thread stays responsive
+    cLevel_Loading_Job job(filename);
+    level = job.Run();
 
     Add(level);
     return level;
@@ -150,15 +220,170 @@ bool cLevel_Manager::Set_Active(cLevel* level)
 
 cLevel* cLevel_Manager::Get(const std::string& levelname)
 {
-    for (vector<cLevel*>::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    Level_Name_Map::iterator itr = m_level_index.find(levelname);
+
+    if (itr == m_level_index.end()) {
+        return NULL;
+    }
+
+    return itr->second;
+}
+
+void cLevel_Manager::Update_Index(void)
+{
+    m_level_index.clear();
+
+    // keep the first level if the name is used more than once
+    for (vector<cLevel*>::reverse_iterator itr = objects.rbegin(); itr != objects.rend(); ++itr) {
         cLevel* obj = (*itr);
 
-        if (obj->Get_Level_Name().compare(levelname) == 0) {
-            return obj;
+        m_level_index[obj->Get_Level_Name()] = obj;
+    }
+}
+
+void cLevel_Manager::Prefetch(const std::string& levelname)
+{
+    // disabled
+    if (!pPreferences->m_level_prefetch_memory) {
+        return;
+    }
+
+    // already loaded
+    if (levelname.empty() || Get(levelname)) {
+        return;
+    }
+
+    // already prefetched
+    for (Level_Loading_Job_List::iterator itr = m_prefetch_jobs.begin(); itr != m_prefetch_jobs.end(); ++itr) {
+        cLevel_Loading_Job* job = (*itr);
+
+        if (job->Get_Level_Name().compare(levelname) == 0) {
+            // mark as recently used
+            m_prefetch_jobs.splice(m_prefetch_jobs.begin(), m_prefetch_jobs, itr);
+            return;
+        }
+    }
+
+    fs::path filename = Get_Path(levelname);
+
+    // only supported level formats
+    if (filename.extension() != fs::path(".tsclvl") && filename.extension() != fs::path(".smclvl")) {
+        return;
+    }
+
+    debug_print("Prefetching level: %s\n", levelname.c_str());
+
+    cLevel_Loading_Job* job = new cLevel_Loading_Job(filename);
+    job->Start();
+    m_prefetch_jobs.push_front(job);
+
+    Limit_Prefetch_Memory();
+}
+
+void cLevel_Manager::Prefetch_Neighbours(cLevel* level)
+{
+    if (!level || editor_enabled) {
+        return;
+    }
+
+    // sublevels
+    for (cSprite_List::iterator itr = level->m_sprite_manager->objects.begin(); itr != level->m_sprite_manager->objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (obj->m_type != TYPE_LEVEL_EXIT) {
+            continue;
+        }
+
+        cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(obj);
+
+        // same level
+        if (level_exit->m_dest_level.empty() || level_exit->m_dest_level.compare(level->Get_Level_Name()) == 0) {
+            continue;
+        }
+
+        Prefetch(level_exit->m_dest_level);
+    }
+
+    // next overworld level
+    if (Game_Mode_Type != MODE_TYPE_LEVEL_CUSTOM && pActive_Overworld && pOverworld_Player) {
+        cWaypoint* current_waypoint = pOverworld_Player->Get_Waypoint();
+
+        if (!current_waypoint || current_waypoint->m_direction_forward == DIR_UNDEFINED) {
+            return;
+        }
+
+        cLayer_Line_Point_Start* front_line = pOverworld_Player->Get_Front_Line(current_waypoint->m_direction_forward);
+
+        if (!front_line) {
+            return;
+        }
+
+        cWaypoint* next_waypoint = front_line->Get_End_Waypoint();
+
+        if (next_waypoint && next_waypoint->m_waypoint_type == WAYPOINT_NORMAL) {
+            Prefetch(next_waypoint->Get_Destination());
+        }
+    }
+}
+
+void cLevel_Manager::Clear_Prefetched(void)
+{
+    for (Level_Loading_Job_List::iterator itr = m_prefetch_jobs.begin(); itr != m_prefetch_jobs.end(); ++itr) {
+        delete *itr;
+    }
+
+    m_prefetch_jobs.clear();
+}
+
+void cLevel_Manager::Update_Prefetch(void)
+{
+    if (m_prefetch_jobs.empty() || editor_enabled) {
+        return;
+    }
+
+    Limit_Prefetch_Memory();
+
+    // finish one level at a time beginning with the most recently used
+    for (Level_Loading_Job_List::iterator itr = m_prefetch_jobs.begin(); itr != m_prefetch_jobs.end(); ++itr) {
+        cLevel_Loading_Job* job = (*itr);
+
+        if (job->Is_Finished() || !job->Is_Prepared()) {
+            continue;
         }
+
+        try {
+            job->Finish(m_prefetch_frame_budget_ms);
+        }
+        catch (InvalidLevelError& err) {
+            cerr << "Warning : Prefetching level " << job->Get_Level_Name() << " failed : " << err.what() << endl;
+            m_prefetch_jobs.erase(itr);
+            delete job;
+        }
+
+        break;
     }
+}
 
-    return NULL;
+void cLevel_Manager::Limit_Prefetch_Memory(void)
+{
+    const size_t max_memory = static_cast<size_t>(pPreferences->m_level_prefetch_memory) * 1024 * 1024;
+    size_t memory = 0;
+
+    for (Level_Loading_Job_List::iterator itr = m_prefetch_jobs.begin(); itr != m_prefetch_jobs.end();) {
+        cLevel_Loading_Job* job = (*itr);
+        memory += job->Get_Memory_Usage();
+
+        // the least recently used ones exceeding the limit
+        if (memory > max_memory) {
+            debug_print("Dropping prefetched level: %s\n", job->Get_Level_Name().c_str());
+            memory -= job->Get_Memory_Usage();
+            itr = m_prefetch_jobs.erase(itr);
+            delete job;
+        }
+        else {
+            ++itr;
+        }
+    }
 }
 
 fs::path cLevel_Manager::Get_Path(const std::string& levelname, bool check_only_user_dir /* = false */)
@@ -227,6 +452,9 @@ fs::path cLevel_Manager::Get_Path(const std::string& levelname, bool check_only_
 
 void cLevel_Manager::Update(void)
 {
+    // finish prefetched levels in the background
+    Update_Prefetch();
+
     // input
     pActive_Level->Process_Input();
 #ifdef ENABLE_EDITOR
@@ -281,6 +509,13 @@ void cLevel_Manager::Update(void)
     // level collisions
     if (!editor_enabled) {
         pActive_Level->m_sprite_manager->Handle_Collision_Items();
+
+#ifdef ENABLE_MRUBY
+        // touch events of this frame
+        if (pActive_Level->m_mruby) {
+            pActive_Level->m_mruby->Fire_Touch_Events();
+        }
+#endif
     }
 
     // update performance timer
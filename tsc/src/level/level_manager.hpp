@@ -21,6 +21,7 @@
 #include "../core/obj_manager.hpp"
 #include "../core/camera.hpp"
 #include "../level/level.hpp"
+#include "../level/level_loading_job.hpp"
 
 namespace TSC {
 
@@ -30,11 +31,29 @@ namespace TSC {
 
     /* *** *** *** *** *** cLevel_Manager  *** *** *** *** *** *** *** *** *** *** *** *** */
 
+    /* Manages the loaded levels
+     *
+     * Levels which can be entered from the active level (sublevels of
+     * its level exits and the next overworld level) are loaded in
+     * advance with cLevel_Loading_Job. They are kept outside of the
+     * loaded levels until Load() asks for them and the least recently
+     * used ones are dropped if they exceed the memory set in the
+     * preferences.
+    */
     class cLevel_Manager : public cObject_Manager<cLevel> {
     public:
         cLevel_Manager(void);
         virtual ~cLevel_Manager(void);
 
+        // Add a level
+        virtual void Add(cLevel* level);
+        // Delete the level from given array number
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        // Delete the given level
+        virtual bool Delete(cLevel* level, bool delete_data = 1);
+        // Delete all levels
+        virtual void Delete_All(void);
+
         // Load level descriptions
         void Init(void);
         // Unload
@@ -53,6 +72,17 @@ namespace TSC {
         bool Set_Active(cLevel* level);
         // Get level pointer
         cLevel* Get(const std::string& levelname);
+        // Rebuild the level name index (needed if a level filename changed)
+        void Update_Index(void);
+
+        /* Start loading the given level in the background
+         * Does nothing if the level is already loaded or prefetched.
+        */
+        void Prefetch(const std::string& levelname);
+        // Prefetch the levels which can be entered from the given level
+        void Prefetch_Neighbours(cLevel* level);
+        // Delete all prefetched levels
+        void Clear_Prefetched(void);
         /* Return the level path if level is valid else empty().
          * check_only_user_dir : only check user directory for the level and
          * skip levels included in the game.
@@ -78,6 +108,23 @@ namespace TSC {
 
         // level camera
         cCamera* m_camera;
+
+        // maximum main thread time in milliseconds used per frame to finish prefetched levels
+        static const unsigned int m_prefetch_frame_budget_ms = 2;
+
+    private:
+        // Finish prefetched levels in small steps and enforce the memory limit
+        void Update_Prefetch(void);
+        // Delete the least recently used prefetched levels exceeding the memory limit
+        void Limit_Prefetch_Memory(void);
+
+        typedef std::unordered_map<std::string, cLevel*> Level_Name_Map;
+        // loaded levels by name
+        Level_Name_Map m_level_index;
+
+        typedef std::list<cLevel_Loading_Job*> Level_Loading_Job_List;
+        // prefetched levels with the most recently used first
+        Level_Loading_Job_List m_prefetch_jobs;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
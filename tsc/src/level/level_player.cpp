@@ -23,6 +23,7 @@
 #include "../core/filesystem/package_manager.hpp"
 #include "../user/preferences.hpp"
 #include "../input/joystick.hpp"
+#include "../input/input_actions.hpp"
 #include "../core/sprite_manager.hpp"
 #include "../core/framerate.hpp"
 #include "../audio/audio.hpp"
@@ -183,7 +184,7 @@ bool cLevel_Player::Set_On_Ground(cSprite* obj, bool set_on_top /* = 1 */)
         }
 
         // if massive ground and ducking key is pressed
-        if (m_ground_object->m_massive_type == MASS_MASSIVE && sf::Keyboard::isKeyPressed(pPreferences->m_key_down)) {
+        if (m_ground_object->m_massive_type == MASS_MASSIVE && pInput_Actions->Held(INP_DOWN)) {
             Start_Ducking();
         }
     }
@@ -290,6 +291,8 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
 
         // move up
         Move(0.0f, -13.0f);
+        // fade out the music
+        pAudio->Update();
         // draw
         Draw_Game();
         // render
@@ -328,6 +331,8 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
 
         // move down
         Move(0.0f, 14.0f);
+        // fade out the music
+        pAudio->Update();
 
         if (m_walk_count > 2.0f) {
             Set_Image_Num(ALEX_IMG_DEAD);
@@ -619,7 +624,7 @@ void cLevel_Player::Update_Walking(void)
     }
 
     // only if left or right is pressed
-    if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->m_left || pJoystick->m_right) {
+    if (pInput_Actions->Held(INP_LEFT) || pInput_Actions->Held(INP_RIGHT)) {
         float ground_mod = 1.0f;
 
         if (m_ground_object && m_ground_object->m_image) {
@@ -723,7 +728,7 @@ void cLevel_Player::Update_Staying(void)
     }
 
     // if left and right is not pressed
-    if (!sf::Keyboard::isKeyPressed(pPreferences->m_key_left) && !sf::Keyboard::isKeyPressed(pPreferences->m_key_right) && !pJoystick->m_left && !pJoystick->m_right) {
+    if (!pInput_Actions->Held(INP_LEFT) && !pInput_Actions->Held(INP_RIGHT)) {
         // walking
         if (m_velx) {
             if (m_ground_object->m_image && m_ground_object->m_image->m_ground_type == GROUND_ICE) {
@@ -789,7 +794,7 @@ void cLevel_Player::Update_Flying(void)
         }
 
         // move down
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->m_down) {
+        if (pInput_Actions->Held(INP_DOWN)) {
             const float max_vel = 5.0f * Get_Vel_Modifier();
 
             if (m_vely < max_vel) {
@@ -797,7 +802,7 @@ void cLevel_Player::Update_Flying(void)
             }
         }
         // move up
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->m_up) {
+        else if (pInput_Actions->Held(INP_UP)) {
             const float max_vel = -5.0f * Get_Vel_Modifier();
 
             if (m_vely > max_vel) {
@@ -816,7 +821,7 @@ void cLevel_Player::Update_Flying(void)
     // falling
     else {
         // move left
-        if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->m_left) && !m_ducked_counter) {
+        if (pInput_Actions->Held(INP_LEFT) && !m_ducked_counter) {
             if (!m_parachute) {
                 const float max_vel = -10.0f * Get_Vel_Modifier();
 
@@ -834,7 +839,7 @@ void cLevel_Player::Update_Flying(void)
             }
         }
         // move right
-        else if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->m_right) && !m_ducked_counter) {
+        else if (pInput_Actions->Held(INP_RIGHT) && !m_ducked_counter) {
             if (!m_parachute) {
                 const float max_vel = 10.0f * Get_Vel_Modifier();
 
@@ -1074,17 +1079,17 @@ void cLevel_Player::Update_Climbing(void)
 
     if (Is_On_Climbable()) {
         // set velocity
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->m_left) {
+        if (pInput_Actions->Held(INP_LEFT)) {
             m_velx = -2.0f * Get_Vel_Modifier();
         }
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->m_right) {
+        else if (pInput_Actions->Held(INP_RIGHT)) {
             m_velx = 2.0f * Get_Vel_Modifier();
         }
 
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->m_up) {
+        if (pInput_Actions->Held(INP_UP)) {
             m_vely = -4.0f * Get_Vel_Modifier();
         }
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->m_down) {
+        else if (pInput_Actions->Held(INP_DOWN)) {
             m_vely = 4.0f * Get_Vel_Modifier();
         }
 
@@ -1132,7 +1137,7 @@ bool cLevel_Player::Is_On_Climbable(float move_y /* = 0.0f */)
 
 void cLevel_Player::Start_Jump_Keytime(void)
 {
-    if (m_god_mode || m_state == STA_STAY || m_state == STA_WALK || m_state == STA_RUN || m_state == STA_FALL || m_state == STA_FLY || m_state == STA_JUMP || (m_state == STA_CLIMB && !sf::Keyboard::isKeyPressed(pPreferences->m_key_up))) {
+    if (m_god_mode || m_state == STA_STAY || m_state == STA_WALK || m_state == STA_RUN || m_state == STA_FALL || m_state == STA_FLY || m_state == STA_JUMP || (m_state == STA_CLIMB && !pInput_Actions->Held(INP_UP))) {
         m_up_key_time = speedfactor_fps / 4;
     }
 }
@@ -1176,7 +1181,7 @@ void cLevel_Player::Start_Jump(float deaccel /* = 0.08f */)
     bool jump_key = 0;
 
     // if jump key pressed
-    if (sf::Keyboard::isKeyPressed(pPreferences->m_key_jump) || (pPreferences->m_joy_analog_jump && pJoystick->m_up) || pJoystick->Button(pPreferences->m_joy_button_jump)) {
+    if (pInput_Actions->Held(INP_JUMP)) {
         jump_key = 1;
     }
 
@@ -1259,7 +1264,7 @@ void cLevel_Player::Update_Jump(void)
     }
 
     // jumping physics
-    if (sf::Keyboard::isKeyPressed(pPreferences->m_key_jump) || (pPreferences->m_joy_analog_jump && pJoystick->m_up) || pJoystick->Button(pPreferences->m_joy_button_jump)) {
+    if (pInput_Actions->Held(INP_JUMP)) {
         Add_Velocity_Y(-(m_jump_accel_up + (m_vely * m_jump_vel_deaccel) / Get_Vel_Modifier()));
         m_jump_power -= pFramerate->m_speed_factor;
     }
@@ -1269,7 +1274,7 @@ void cLevel_Player::Update_Jump(void)
     }
 
     // left right physics
-    if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->m_left) && !m_ducked_counter) {
+    if (pInput_Actions->Held(INP_LEFT) && !m_ducked_counter) {
         const float max_vel = -10.0f * Get_Vel_Modifier();
 
         if (m_velx > max_vel) {
@@ -1277,7 +1282,7 @@ void cLevel_Player::Update_Jump(void)
         }
 
     }
-    else if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->m_right) && !m_ducked_counter) {
+    else if (pInput_Actions->Held(INP_RIGHT) && !m_ducked_counter) {
         const float max_vel = 10.0f * Get_Vel_Modifier();
 
         if (m_velx < max_vel) {
@@ -1342,7 +1347,7 @@ void cLevel_Player::Update_Item(void)
     }
 
     // if control is pressed search for items in front of the player
-    if (sf::Keyboard::isKeyPressed(pPreferences->m_key_action) || pJoystick->Button(pPreferences->m_joy_button_action)) {
+    if (pInput_Actions->Held(INP_ACTION)) {
         // next position velocity with extra size
         float check_x = (m_velx > 0.0f) ? (m_velx + 5.0f) : (m_velx - 5.0f);
 
@@ -2864,7 +2869,7 @@ float cLevel_Player::Get_Vel_Modifier(void) const
     float vel_mod = 1.0f;
 
     // if running key is pressed or always run
-    if (pPreferences->m_always_run || sf::Keyboard::isKeyPressed(pPreferences->m_key_action) || pJoystick->Button(pPreferences->m_joy_button_action)) {
+    if (pPreferences->m_always_run || pInput_Actions->Held(INP_ACTION)) {
         vel_mod = 1.5f;
     }
 
@@ -3178,7 +3183,7 @@ void cLevel_Player::Action_Stop_Interact(input_identifier key_type)
     // Left
     else if (key_type == INP_LEFT) {
         // if key in opposite direction is still pressed only change direction
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->m_right) {
+        if (pInput_Actions->Held(INP_RIGHT)) {
             m_direction = DIR_RIGHT;
         }
         else {
@@ -3188,7 +3193,7 @@ void cLevel_Player::Action_Stop_Interact(input_identifier key_type)
     // Right
     else if (key_type == INP_RIGHT) {
         // if key in opposite direction is still pressed only change direction
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->m_left) {
+        if (pInput_Actions->Held(INP_LEFT)) {
             m_direction = DIR_LEFT;
         }
         else {
@@ -3516,7 +3521,7 @@ Col_Valid_Type cLevel_Player::Validate_Collision(cSprite* obj)
     }
     else if (obj->m_massive_type == MASS_HALFMASSIVE) {
         // fall through
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down)) {
+        if (pInput_Actions->Held(INP_DOWN)) {
             return COL_VTYPE_NOT_VALID;
         }
 
@@ -3563,23 +3568,23 @@ Col_Valid_Type cLevel_Player::Validate_Collision(cSprite* obj)
 
             // warp levelexit key check
             if (levelexit->m_exit_type == LEVEL_EXIT_WARP) {
-                // joystick events are sent as keyboard keys
-                if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up)) {
+                // held keyboard keys and joystick directions
+                if (pInput_Actions->Held(INP_UP)) {
                     if (levelexit->m_start_direction == DIR_UP) {
                         Action_Interact(INP_UP);
                     }
                 }
-                else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down)) {
+                else if (pInput_Actions->Held(INP_DOWN)) {
                     if (levelexit->m_start_direction == DIR_DOWN) {
                         Action_Interact(INP_DOWN);
                     }
                 }
-                else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right)) {
+                else if (pInput_Actions->Held(INP_RIGHT)) {
                     if (levelexit->m_start_direction == DIR_RIGHT) {
                         Action_Interact(INP_RIGHT);
                     }
                 }
-                else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left)) {
+                else if (pInput_Actions->Held(INP_LEFT)) {
                     if (levelexit->m_start_direction == DIR_LEFT) {
                         Action_Interact(INP_LEFT);
                     }
@@ -3747,7 +3752,7 @@ void cLevel_Player::Handle_Collision_Massive(cObjectCollision* collision)
     // climbable
     if (col_obj->m_massive_type == MASS_CLIMBABLE && m_state != STA_CLIMB && m_state != STA_FLY) {
         // if not climbing and player wants to climb
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->m_up || ((sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->m_down) && !m_ground_object)) {
+        if (pInput_Actions->Held(INP_UP) || (pInput_Actions->Held(INP_DOWN) && !m_ground_object)) {
             // start climbing
             Start_Climbing();
         }
@@ -77,10 +77,15 @@ void cBall::Init(void)
 
     Set_Spawned(1);
     m_camera_range = 2000;
+    // destroys itself out of range
+    m_sleep_policy = SLEEP_NEVER;
 
     m_massive_type = MASS_MASSIVE;
 
     m_glim_mod = 0.1f;
+
+    m_explode_sound = "item/fireball_explode.wav";
+    m_repelled_sound = "item/fireball_repelled.wav";
     m_glim_counter = 0.0f;
     m_fire_counter = 0.0f;
 
@@ -152,7 +157,7 @@ void cBall::Destroy_Ball(bool with_sound /* = 0 */)
 {
     if (with_sound) {
         if (m_ball_type == FIREBALL_DEFAULT) {
-            pAudio->Play_Sound("item/fireball_explode.wav");
+            pAudio->Play_Sound(m_explode_sound);
         }
     }
 
@@ -382,7 +387,7 @@ void cBall::Handle_Collision_Player(cObjectCollision* collision)
         }
     }
 
-    pAudio->Play_Sound("item/fireball_repelled.wav");
+    pAudio->Play_Sound(m_repelled_sound);
     Destroy();
 }
 
@@ -392,7 +397,7 @@ void cBall::Handle_Collision_Enemy(cObjectCollision* collision)
 
     // if enemy is not vulnerable
     if ((m_ball_type == FIREBALL_DEFAULT && enemy->m_fire_resistant) || (m_ball_type == ICEBALL_DEFAULT && enemy->m_ice_resistance >= 1)) {
-        pAudio->Play_Sound("item/fireball_repelled.wav");
+        pAudio->Play_Sound(m_repelled_sound);
     }
     // make enemy handle the ball
     else {
@@ -19,6 +19,7 @@
 
 #include "../video/video.hpp"
 #include "../objects/movingsprite.hpp"
+#include "../audio/audio.hpp"
 
 namespace TSC {
 
@@ -95,6 +96,10 @@ namespace TSC {
         // ball type
         ball_effect m_ball_type;
 
+        // sounds
+        cSound_Handle m_explode_sound;
+        cSound_Handle m_repelled_sound;
+
         // glim animation modifier
         float m_glim_mod;
         // glim animation counter
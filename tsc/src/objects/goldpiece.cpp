@@ -126,6 +126,13 @@ void cGoldpiece::Set_Gold_Color(DefaultColor color)
         }
     }
 
+    if (m_color_type == COL_RED) {
+        m_sound = "item/jewel_2.ogg";
+    }
+    else {
+        m_sound = "item/jewel_1.ogg";
+    }
+
     Set_Image_Set("main", 1);
     if (m_type == TYPE_JUMPING_GOLDPIECE || m_type == TYPE_FALLING_GOLDPIECE) {
         Set_Animation_Speed(1.143);
@@ -165,12 +172,7 @@ void cGoldpiece::Activate(void)
         points *= 2;
     }
     else {
-        if (m_color_type == COL_RED) {
-            pAudio->Play_Sound("item/jewel_2.ogg");
-        }
-        else {
-            pAudio->Play_Sound("item/jewel_1.ogg");
-        }
+        pAudio->Play_Sound(m_sound);
     }
 
     pHud_Points->Add_Points(points, m_pos_x + m_col_rect.m_w / 2, m_pos_y + 2);
@@ -20,6 +20,7 @@
 #include "../core/global_basic.hpp"
 #include "../core/xml_attributes.hpp"
 #include "../objects/movingsprite.hpp"
+#include "../audio/audio.hpp"
 #include "../scripting/objects/specials/mrb_jewel.hpp"
 #include "../scripting/objects/specials/mrb_jumping_jewel.hpp"
 #include "../scripting/objects/specials/mrb_falling_jewel.hpp"
@@ -73,6 +74,8 @@ namespace TSC {
 
         // gold color
         DefaultColor m_color_type;
+        // sound if collected
+        cSound_Handle m_sound;
 
         // Save to node
         virtual xmlpp::Element* Save_To_XML_Node(xmlpp::Element* p_element);
@@ -117,6 +117,7 @@ void cMoving_Platform::Init(void)
     m_can_be_on_ground = 0;
 
     m_camera_range = 3000;
+    m_sleep_policy = SLEEP_REDUCED;
     m_can_be_ground = 1;
 
     m_move_type = MOVING_PLATFORM_TYPE_LINE;
@@ -231,7 +232,7 @@ xmlpp::Element* cMoving_Platform::Save_To_XML_Node(xmlpp::Element* p_element)
 
 void cMoving_Platform::Set_Sprite_Manager(cSprite_Manager* sprite_manager)
 {
-    cSprite::Set_Sprite_Manager(sprite_manager);
+    cMovingSprite::Set_Sprite_Manager(sprite_manager);
     m_path_state.Set_Sprite_Manager(sprite_manager);
 }
 
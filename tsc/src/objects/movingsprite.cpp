@@ -31,8 +31,89 @@
 
 namespace TSC {
 
+/* *** *** *** *** *** *** *** cContact_Set *** *** *** *** *** *** *** *** *** *** */
+
+cContact_Set::cContact_Set(void)
+{
+    m_delete_count = cSprite_Manager::m_delete_count;
+}
+
+void cContact_Set::Add(cSprite* obj, ObjectDirection direction)
+{
+    // pointers may be invalid
+    if (!Is_Current()) {
+        Clear();
+    }
+
+    Contact_List::iterator itr = m_contacts.begin();
+
+    for (; itr != m_contacts.end(); ++itr) {
+        if (itr->m_obj == obj) {
+            break;
+        }
+    }
+
+    // new contact
+    if (itr == m_contacts.end()) {
+        itr = m_contacts.insert(m_contacts.end(), Contact());
+        itr->m_obj = obj;
+    }
+
+    itr->m_direction = direction;
+    itr->m_col_rect = obj->m_col_rect;
+}
+
+void cContact_Set::Remove_Separated(const GL_rect& rect)
+{
+    // pointers may be invalid
+    if (!Is_Current()) {
+        Clear();
+        return;
+    }
+
+    // touching is intersecting the rect extended by one pixel
+    GL_rect touch_rect(rect.m_x - 1.0f, rect.m_y - 1.0f, rect.m_w + 2.0f, rect.m_h + 2.0f);
+
+    for (Contact_List::iterator itr = m_contacts.begin(); itr != m_contacts.end();) {
+        if (itr->m_obj->m_auto_destroy || !touch_rect.Intersects(itr->m_obj->m_col_rect)) {
+            itr = m_contacts.erase(itr);
+        }
+        else {
+            ++itr;
+        }
+    }
+}
+
+void cContact_Set::Clear(void)
+{
+    m_contacts.clear();
+    m_delete_count = cSprite_Manager::m_delete_count;
+}
+
+bool cContact_Set::Is_Current(void) const
+{
+    return m_delete_count == cSprite_Manager::m_delete_count;
+}
+
+bool cContact_Set::Is_Unchanged(void) const
+{
+    if (!Is_Current()) {
+        return 0;
+    }
+
+    for (Contact_List::const_iterator itr = m_contacts.begin(); itr != m_contacts.end(); ++itr) {
+        if (itr->m_obj->m_auto_destroy || itr->m_obj->m_col_rect != itr->m_col_rect) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
 /* *** *** *** *** *** *** *** cMovingSprite *** *** *** *** *** *** *** *** *** *** */
 
+const uint32_t cMovingSprite::m_anti_stuck_recheck_frames = 10;
+
 cMovingSprite::cMovingSprite(cSprite_Manager* sprite_manager, std::string type_name /* = "sprite" */)
     : cSprite(sprite_manager, type_name)
 {
@@ -145,6 +226,22 @@ void cMovingSprite::Init(void)
 
     m_ice_resistance = 0.0f;
     m_freeze_counter = 0.0f;
+
+    m_collide_move_x = 0.0f;
+    m_collide_move_y = 0.0f;
+    m_collide_move_frame = pFramerate->m_frame_number - 1;
+    m_col_move_ignore = NULL;
+
+    m_anti_stuck_skipped = m_anti_stuck_recheck_frames;
+}
+
+void cMovingSprite::Set_Sprite_Manager(cSprite_Manager* sprite_manager)
+{
+    cSprite::Set_Sprite_Manager(sprite_manager);
+
+    // contacts are from the old manager
+    m_contacts.Clear();
+    m_anti_stuck_skipped = m_anti_stuck_recheck_frames;
 }
 
 cMovingSprite* cMovingSprite::Copy(void) const
@@ -445,6 +542,11 @@ void cMovingSprite::Col_Move(float move_x, float move_y, bool real /* = 0 */, bo
         cSprite_List sprite_list;
         m_sprite_manager->Get_Colliding_Objects(sprite_list, complete_rect, 1, this);
 
+        // moving with this object
+        if (m_col_move_ignore) {
+            sprite_list.erase(std::remove(sprite_list.begin(), sprite_list.end(), m_col_move_ignore), sprite_list.end());
+        }
+
         // step size
         float step_size_x = move_x;
         float step_size_y = move_y;
@@ -490,6 +592,17 @@ void cMovingSprite::Col_Move(float move_x, float move_y, bool real /* = 0 */, bo
             delete col_list;
             col_list = Col_Move_in_Steps(move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list);
 
+            // remember the blocking objects we touch
+            m_contacts.Remove_Separated(m_col_rect);
+
+            for (cObjectCollision_List::iterator itr = col_list->objects.begin(); itr != col_list->objects.end(); ++itr) {
+                cObjectCollision* col = (*itr);
+
+                if (col->m_valid_type == COL_VTYPE_BLOCKING) {
+                    m_contacts.Add(col->m_obj, col->m_direction);
+                }
+            }
+
             Add_Collisions(col_list, 1);
         }
 
@@ -892,6 +1005,11 @@ void cMovingSprite::Check_on_Ground(void)
         return;
     }
 
+    // ground already touched while moving
+    if (Set_On_Ground_Contact()) {
+        return;
+    }
+
     // new onground check
     cObjectCollisionType* col_list = Collision_Check_Relative(0.0f, m_col_rect.m_h, 0.0f, 1.0f, COLLIDE_ONLY_BLOCKING);
 
@@ -904,6 +1022,8 @@ void cMovingSprite::Check_on_Ground(void)
         // ground collision found
         if (col->m_direction == DIR_BOTTOM) {
             if (Set_On_Ground(col->m_obj)) {
+                m_contacts.Add(col->m_obj, DIR_BOTTOM);
+
                 // send collision ( needed for falling platform )
                 Send_Collision(col);
                 break;
@@ -914,10 +1034,62 @@ void cMovingSprite::Check_on_Ground(void)
     delete col_list;
 }
 
+bool cMovingSprite::Set_On_Ground_Contact(void)
+{
+    if (!m_contacts.Is_Current()) {
+        return 0;
+    }
+
+    GL_rect rect2(m_col_rect.m_x, m_col_rect.m_y + m_col_rect.m_h, m_col_rect.m_w, 1.0f);
+
+    for (cContact_Set::Contact_List::const_iterator itr = m_contacts.m_contacts.begin(); itr != m_contacts.m_contacts.end(); ++itr) {
+        cSprite* obj = itr->m_obj;
+
+        // same conditions as the collision check
+        if (itr->m_direction != DIR_BOTTOM || obj->m_auto_destroy || !rect2.Intersects(obj->m_col_rect)) {
+            continue;
+        }
+
+        if (obj->m_sprite_array == ARRAY_UNDEFINED || obj->m_sprite_array == ARRAY_HUD || obj->m_sprite_array == ARRAY_ANIM) {
+            continue;
+        }
+
+        if (obj->m_sprite_array == ARRAY_ENEMY && static_cast<cEnemy*>(obj)->m_dead) {
+            continue;
+        }
+
+        if (Validate_Collision(obj) != COL_VTYPE_BLOCKING) {
+            continue;
+        }
+
+        cObjectCollision* col = Create_Collision_Object(this, obj, COL_VTYPE_BLOCKING);
+
+        if (col->m_direction == DIR_BOTTOM && Set_On_Ground(obj)) {
+            // send collision ( needed for falling platform )
+            Send_Collision(col);
+            delete col;
+            return 1;
+        }
+
+        delete col;
+    }
+
+    return 0;
+}
+
 void cMovingSprite::Update_Anti_Stuck(void)
 {
+    // resting and no touching object moved, only check again from time to time
+    if (m_anti_stuck_skipped < m_anti_stuck_recheck_frames && m_col_rect == m_anti_stuck_rect && m_contacts.Is_Unchanged()) {
+        m_anti_stuck_skipped++;
+        return;
+    }
+
+    m_anti_stuck_skipped = 0;
+
     // collision count
     cObjectCollisionType* col_list = Collision_Check(&m_col_rect, COLLIDE_ONLY_BLOCKING);
+    bool stuck = 0;
 
     // check collisions
     for (cObjectCollision_List::iterator itr = col_list->objects.begin(); itr != col_list->objects.end(); ++itr) {
@@ -929,6 +1101,7 @@ void cMovingSprite::Update_Anti_Stuck(void)
         }
 
         debug_print("Anti Stuck detected object %s on %s side\n", col_obj->Create_Name().c_str(), Get_Direction_Name(collision->m_direction).c_str());
+        stuck = 1;
 
         if (collision->m_direction == DIR_LEFT) {
             Col_Move(1.0f, 0.0f, 0, 1);
@@ -945,6 +1118,23 @@ void cMovingSprite::Update_Anti_Stuck(void)
     }
 
     delete col_list;
+
+    // check again next frame
+    if (stuck) {
+        m_anti_stuck_skipped = m_anti_stuck_recheck_frames;
+        return;
+    }
+
+    m_anti_stuck_rect = m_col_rect;
+
+    // restart the contacts if a sprite got deleted
+    if (!m_contacts.Is_Current()) {
+        m_contacts.Clear();
+
+        if (m_ground_object) {
+            m_contacts.Add(m_ground_object, DIR_BOTTOM);
+        }
+    }
 }
 
 void cMovingSprite::Collide_Move(void)
@@ -953,19 +1143,76 @@ void cMovingSprite::Collide_Move(void)
         return;
     }
 
-    // move and create collision data
-    Col_Move(m_velx, m_vely);
+    float pos_x = m_pos_x;
+    float pos_y = m_pos_y;
+
+    // ground not yet moved
+    if (!Move_With_Moved_Ground()) {
+        // move and create collision data
+        Col_Move(m_velx, m_vely);
+
+        Move_With_Ground();
+    }
 
-    Move_With_Ground();
+    // for objects carried by us
+    m_collide_move_x = m_pos_x - pos_x;
+    m_collide_move_y = m_pos_y - pos_y;
+    m_collide_move_frame = pFramerate->m_frame_number;
 }
 
-void cMovingSprite::Move_With_Ground(void)
+cSprite* cMovingSprite::Get_Carrier(void) const
 {
     if (!m_ground_object || (m_ground_object->m_sprite_array != ARRAY_ACTIVE && m_ground_object->m_sprite_array != ARRAY_ENEMY)) {  // || m_ground_object->sprite_array == ARRAY_MASSIVE
-        return;
+        return NULL;
+    }
+
+    return m_ground_object;
+}
+
+bool cMovingSprite::Move_With_Moved_Ground(void)
+{
+    cMovingSprite* moving_ground_object = dynamic_cast<cMovingSprite*>(Get_Carrier());
+
+    // invalid moving sprite or not yet moved
+    if (!moving_ground_object || moving_ground_object->m_collide_move_frame != pFramerate->m_frame_number) {
+        return 0;
+    }
+
+    float move_x = moving_ground_object->m_collide_move_x;
+    float move_y = moving_ground_object->m_collide_move_y;
+
+    // did not move
+    if (Is_Float_Equal(move_x, 0.0f) && Is_Float_Equal(move_y, 0.0f)) {
+        Col_Move(m_velx, m_vely);
+        return 1;
+    }
+
+    // the ground is already at its new position and can not block us
+    m_col_move_ignore = moving_ground_object;
+    Col_Move(m_velx * pFramerate->m_speed_factor + move_x, m_vely * pFramerate->m_speed_factor + move_y, 1);
+    m_col_move_ignore = NULL;
+
+    // ground moved upwards but something did block us
+    if (move_y < -0.01f && m_ground_object == moving_ground_object && m_col_rect.m_y + m_col_rect.m_h > moving_ground_object->m_col_rect.m_y) {
+        // massive
+        if (moving_ground_object->m_massive_type == MASS_MASSIVE) {
+            // got crunched
+            DownGrade(1);
+        }
+        // halfmassive
+        else if (moving_ground_object->m_massive_type == MASS_HALFMASSIVE) {
+            // lost ground
+            Move(0.0f, 1.9f, 1);
+            Reset_On_Ground();
+        }
     }
 
-    cMovingSprite* moving_ground_object = dynamic_cast<cMovingSprite*>(m_ground_object);
+    return 1;
+}
+
+void cMovingSprite::Move_With_Ground(void)
+{
+    cMovingSprite* moving_ground_object = dynamic_cast<cMovingSprite*>(Get_Carrier());
 
     // invalid moving sprite
     if (!moving_ground_object) {
@@ -54,6 +54,42 @@ namespace TSC {
         COLLIDE_COMPLETE = 3
     };
 
+    /* *** *** *** *** *** *** *** cContact_Set *** *** *** *** *** *** *** *** *** *** */
+
+    /* Blocking objects touching a moving sprite and the side they touch it
+     * Kept across frames and filled from the Col_Move collisions.
+     * The object pointers are only valid as long as no sprite got deleted.
+    */
+    class cContact_Set {
+    public:
+        cContact_Set(void);
+
+        // add the object or update its side and position
+        void Add(cSprite* obj, ObjectDirection direction);
+        // remove the contacts no longer touching the given rect
+        void Remove_Separated(const GL_rect& rect);
+        // remove all contacts
+        void Clear(void);
+
+        // if no sprite got deleted since the contacts were added
+        bool Is_Current(void) const;
+        // if current and no contact object moved or got destroyed since it was added
+        bool Is_Unchanged(void) const;
+
+        struct Contact {
+            cSprite* m_obj;
+            // side of the object touching us
+            ObjectDirection m_direction;
+            // object collision rect when added
+            GL_rect m_col_rect;
+        };
+
+        typedef std::vector<Contact> Contact_List;
+        Contact_List m_contacts;
+        // sprite manager delete count when the contacts were added
+        uint32_t m_delete_count;
+    };
+
     /* *** *** *** *** *** *** *** cMovingSprite *** *** *** *** *** *** *** *** *** *** */
 
     class cMovingSprite : public cSprite {
@@ -81,6 +117,9 @@ namespace TSC {
             return mrb_obj_value(Data_Wrap_Struct(p_state, mrb_class_get(p_state, "MovingSprite"), &Scripting::rtTSC_Scriptable, this));
         }
 
+        // Set the parent sprite manager
+        virtual void Set_Sprite_Manager(cSprite_Manager* sprite_manager);
+
         /* Sets the image for drawing
          * if new_start_image is set the default start_image will be set to the given image
          * if del_img is set the given image will be deleted
@@ -110,6 +149,11 @@ namespace TSC {
          * massive moving ground can crunch us
         */
         void Move_With_Ground(void);
+        /* if the ground object already moved in this frame move with its position change
+         * and our velocity in one collision move
+         * returns false if not carried by a moved object
+        */
+        bool Move_With_Moved_Ground(void);
 
         // Set velocity
         inline void Set_Velocity(const float x, const float y)
@@ -223,6 +267,10 @@ namespace TSC {
         virtual bool Set_On_Ground(cSprite* obj, bool set_on_top = 1);
         // Check if the Object is onground and sets the state to onground
         virtual void Check_on_Ground(void);
+        /* Set the ground from the contacts touching our bottom
+         * returns true if a valid ground object was found
+        */
+        bool Set_On_Ground_Contact(void);
         // object looses onground state
         inline void Reset_On_Ground(void)
         {
@@ -233,6 +281,8 @@ namespace TSC {
 
         // default collision and movement handling
         virtual void Collide_Move(void);
+        // the moving ground object
+        virtual cSprite* Get_Carrier(void) const;
 
         /* Freeze for the given time
         */
@@ -291,6 +341,13 @@ namespace TSC {
         bool m_can_be_on_ground;
         // colliding ground object
         cSprite* m_ground_object;
+        // touching blocking objects
+        cContact_Set m_contacts;
+        // position change of the last Collide_Move
+        float m_collide_move_x;
+        float m_collide_move_y;
+        // frame number of the last Collide_Move
+        uint32_t m_collide_move_frame;
 
         /* the different states
          * look at the definitions
@@ -303,6 +360,15 @@ namespace TSC {
         float m_freeze_counter;
 
     private:
+        // object ignored by Col_Move while moving with it
+        const cSprite* m_col_move_ignore;
+        // collision rect at the last anti stuck check without stuck collisions
+        GL_rect m_anti_stuck_rect;
+        // anti stuck checks skipped since the last complete check
+        uint32_t m_anti_stuck_skipped;
+        // frames between complete anti stuck checks while resting
+        static const uint32_t m_anti_stuck_recheck_frames;
+
         /* moves in steps and checks in both directions simultaneous
          * returns the found collisions
          * sprite_list : objects to check
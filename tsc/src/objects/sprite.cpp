@@ -26,7 +26,6 @@
 #include "../core/sprite_manager.hpp"
 #include "../core/editor/editor.hpp"
 #include "../core/i18n.hpp"
-#include "../scripting/events/touch_event.hpp"
 #include "../level/level_settings.hpp"
 #include "../level/level_editor.hpp"
 #include "../overworld/world_editor.hpp"
@@ -274,12 +273,9 @@ void cCollidingSprite::Handle_Collision(cObjectCollision* collision)
              * this doesn’t exclude important sprites from being listened to
              * in MRuby. --Marvin Gülker (aka Quintus) */
             cSprite* p_sprite = dynamic_cast<cSprite*>(this);
-            if (p_sprite) {
-                // Fire the event for both objects, eases registering
-                Scripting::cTouch_Event evt1(collision->m_obj);
-                Scripting::cTouch_Event evt2(p_sprite);
-                evt1.Fire(pActive_Level->m_mruby, p_sprite);
-                evt2.Fire(pActive_Level->m_mruby, collision->m_obj);
+            // The events are fired in one batch after the collision handling
+            if (p_sprite && collision->m_obj && pActive_Level->m_mruby) {
+                pActive_Level->m_mruby->Queue_Touch_Event(p_sprite, collision->m_obj);
             }
 #ifdef ENABLE_EDITOR
         }
@@ -434,7 +430,13 @@ void cSprite::Init(void)
     m_valid_draw = 1;
     m_valid_update = 1;
 
+    m_sleep_policy = SLEEP_FULL;
+    m_activity = ACTIVITY_AWAKE;
+    m_wake_counter = 0.0f;
+    m_skipped_speed_factor = 0.0f;
+
     m_uid = -1;
+    m_array_num = -1;
 }
 
 cSprite* cSprite::Copy(void) const
@@ -728,6 +730,10 @@ void cSprite::Set_Active(bool enabled)
 
     m_active = enabled;
 
+    if (m_active) {
+        Wake_Up();
+    }
+
     Update_Valid_Draw();
     Update_Valid_Update();
 }
@@ -1056,7 +1062,7 @@ void cSprite::Draw_Image(cSurface_Request* request /* = NULL */) const
 void cSprite::Draw_Image_Normal(cSurface_Request* request /* = NULL */) const
 {
     // texture id
-    request->m_texture_id = m_image->m_image;
+    request->m_texture_id = m_image->Get_Texture();
 
     // size
     request->m_w = m_image->m_start_w;
@@ -1148,7 +1154,7 @@ void cSprite::Draw_Image_Normal(cSurface_Request* request /* = NULL */) const
 void cSprite::Draw_Image_Editor(cSurface_Request* request /* = NULL */) const
 {
     // texture id
-    request->m_texture_id = m_start_image->m_image;
+    request->m_texture_id = m_start_image->Get_Texture();
 
     // size
     request->m_w = m_start_image->m_start_w;
@@ -1359,6 +1365,58 @@ bool cSprite::Is_Update_Valid()
     return 1;
 }
 
+SpriteActivity cSprite::Update_Activity(void)
+{
+    if (m_wake_counter > 0.0f) {
+        m_wake_counter -= pFramerate->m_speed_factor;
+        m_activity = ACTIVITY_AWAKE;
+    }
+    else if (m_sleep_policy == SLEEP_NEVER || m_no_camera || this == pActive_Player) {
+        m_activity = ACTIVITY_AWAKE;
+    }
+    else {
+        // at least the screen size as a small camera range means visible on the screen
+        const float range = static_cast<float>(max(m_camera_range, static_cast<unsigned int>(max(game_res_w, game_res_h))));
+        const float center_x = m_rect.m_x + (m_rect.m_w * 0.5f);
+        const float center_y = m_rect.m_y + (m_rect.m_h * 0.5f);
+
+        // distance of the rect edges to the camera center
+        float distance = max(fabs(center_x - (pActive_Camera->m_x + (game_res_w * 0.5f))) - (m_rect.m_w * 0.5f), fabs(center_y - (pActive_Camera->m_y + (game_res_h * 0.5f))) - (m_rect.m_h * 0.5f));
+
+        // the camera can be moved away from the player
+        if (pActive_Player) {
+            const float player_distance = max(fabs(center_x - (pActive_Player->m_rect.m_x + (pActive_Player->m_rect.m_w * 0.5f))) - (m_rect.m_w * 0.5f), fabs(center_y - (pActive_Player->m_rect.m_y + (pActive_Player->m_rect.m_h * 0.5f))) - (m_rect.m_h * 0.5f));
+
+            if (player_distance < distance) {
+                distance = player_distance;
+            }
+        }
+
+        if (distance <= range) {
+            m_activity = ACTIVITY_AWAKE;
+        }
+        else if (distance <= range * 2.0f || m_sleep_policy == SLEEP_REDUCED) {
+            m_activity = ACTIVITY_REDUCED;
+        }
+        else {
+            m_activity = ACTIVITY_ASLEEP;
+        }
+    }
+
+    if (m_activity != ACTIVITY_REDUCED) {
+        m_skipped_speed_factor = 0.0f;
+    }
+
+    return m_activity;
+}
+
+void cSprite::Wake_Up(float time /* = speedfactor_fps * 2.0f */)
+{
+    if (m_wake_counter < time) {
+        m_wake_counter = time;
+    }
+}
+
 bool cSprite::Is_Draw_Valid(void)
 {
     // if editor not enabled
@@ -353,6 +353,11 @@ namespace TSC {
 
         // default collision and movement handling
         virtual void Collide_Move(void) {};
+        // the object moving this one with it or NULL
+        virtual cSprite* Get_Carrier(void) const
+        {
+            return NULL;
+        };
 
         // Update the position rect values
         void Update_Position_Rect(void);
@@ -398,6 +403,15 @@ namespace TSC {
         bool Is_In_Range(void) const;
         // if update is valid for the current state
         virtual bool Is_Update_Valid();
+
+        /* Set the activity state from the distance to the camera and the player
+         * Called by the sprite manager every frame before Update().
+        */
+        SpriteActivity Update_Activity(void);
+        /* Keep this awake for the given time even if far away
+         * Used if it is woken by a collision, a script or an activation.
+        */
+        void Wake_Up(float time = speedfactor_fps * 2.0f);
         // if draw is valid for the current state and position
         virtual bool Is_Draw_Valid(void);
 
@@ -559,8 +573,19 @@ namespace TSC {
         /// if updating is valid
         bool m_valid_update;
 
+        /// what this does far away
+        SleepPolicy m_sleep_policy;
+        /// current activity state
+        SpriteActivity m_activity;
+        /// time left this is kept awake
+        float m_wake_counter;
+        /// speedfactor of the frames skipped in the reduced activity state
+        float m_skipped_speed_factor;
+
         /// ID to uniquely identify this sprite (UIDS[idhere] uses this)
         int m_uid;
+        /// Slot in the sprite manager objects kept by cSprite_Manager or -1
+        int m_array_num;
 
         static const float m_pos_z_passive_start; ///< Start Z position for passive elements
         static const float m_pos_z_massive_start; ///< Start Z position for massive elements
@@ -112,7 +112,22 @@ cOverworld* cOverworld::Load_From_Directory(fs::path directory, int user_dir /*
 {
     // Overworld loading consists of three steps: Loading the description file,
     // loading the main world file and loading the layers file.
-    debug_print("Loading world from directory '%s'\n", path_to_utf8(directory).c_str());
+    cOverworld* p_overworld = Load_Description_From_Directory(directory, user_dir);
+
+    try {
+        p_overworld->Load_Content();
+    }
+    catch (...) {
+        delete p_overworld;
+        throw;
+    }
+
+    return p_overworld;
+}
+
+cOverworld* cOverworld::Load_Description_From_Directory(fs::path directory, int user_dir /* = 0 */)
+{
+    debug_print("Loading world description from directory '%s'\n", path_to_utf8(directory).c_str());
 
     //////// Step 1: Description file ////////
     cOverworldDescriptionLoader descloader;
@@ -122,28 +137,53 @@ cOverworld* cOverworld::Load_From_Directory(fs::path directory, int user_dir /*
     p_desc->Set_Path(directory); // FIXME: Post-initialization violates OOP principle of secrecy. `m_path' needs to be moved into cOverworld!
     p_desc->m_user = user_dir; // FIXME: Post-initialization violates OOP principle of secrecy.
 
-    //////// Step 2: Main world file ////////
-    cOverworldLoader worldloader;
-    worldloader.parse_file(directory / utf8_to_path("world.xml"));
-    cOverworld* p_overworld = worldloader.Get_Overworld();
-
     // Replace the old default description for world_1 with the correct one
     // we loaded previously.
-    delete p_overworld->m_description;
-    p_overworld->m_description = p_desc;
+    cOverworld* p_overworld = new cOverworld();
+    p_overworld->Replace_Description(p_desc);
+
+    return p_overworld;
+}
+
+void cOverworld::Load_Content(void)
+{
+    // already loaded
+    if (Is_Loaded()) {
+        return;
+    }
+
+    fs::path directory = m_description->Get_Path();
+    debug_print("Loading world from directory '%s'\n", path_to_utf8(directory).c_str());
 
-    //////// Step 3: Layers file ////////
-    cOverworldLayerLoader layerloader(p_overworld);
-    layerloader.parse_file(directory / utf8_to_path("layer.xml"));
+    cOverworldLayerLoader layerloader(this);
+
+    try {
+        //////// Step 2: Main world file ////////
+        cOverworldLoader worldloader(this);
+        worldloader.parse_file(directory / utf8_to_path("world.xml"));
+
+        //////// Step 3: Layers file ////////
+        layerloader.parse_file(directory / utf8_to_path("layer.xml"));
+    }
+    catch (...) {
+        // the lines are deleted with the sprite manager objects
+        delete layerloader.Get_Layer();
+
+        // remove the partially loaded objects
+        m_engine_version = 0;
+        Unload();
+        throw;
+    }
 
     // Replace the old default layer with the one we just loaded
-    delete p_overworld->m_layer;
-    p_overworld->m_layer = layerloader.Get_Layer();
+    delete m_layer;
+    m_layer = layerloader.Get_Layer();
 
-    // Set the text that is displayed at the top when this world is shown
-    pFont->Prepare_SFML_Text(p_overworld->m_hud_world_name, p_overworld->m_description->m_name, 10, static_cast<float>(game_res_h) - 30, cFont_Manager::FONTSIZE_NORMAL, yellow);
+    // Waypoint and line lookup
+    m_path_graph->Build();
 
-    return p_overworld;
+    // Set the text that is displayed at the top when this world is shown
+    pFont->Prepare_SFML_Text(m_hud_world_name, m_description->m_name, 10, static_cast<float>(game_res_h) - 30, cFont_Manager::FONTSIZE_NORMAL, yellow);
 }
 
 cOverworld::~cOverworld(void)
@@ -154,10 +194,12 @@ cOverworld::~cOverworld(void)
     delete m_animation_manager;
     delete m_description;
     delete m_layer;
+    delete m_path_graph;
 }
 
 void cOverworld::Init()
 {
+    m_path_graph = new cWorld_Path_Graph(this);
     m_sprite_manager = new cWorld_Sprite_Manager(this);
     m_animation_manager = new cAnimation_Manager();
     m_description = new cOverworld_description();
@@ -211,6 +253,8 @@ void cOverworld::Unload(void)
     m_waypoints.clear();
     // Layer
     m_layer->Delete_All();
+    // Graph
+    m_path_graph->Invalidate();
     // animations
     m_animation_manager->Delete_All();
 
@@ -711,6 +755,18 @@ void cOverworld::Set_Progress(unsigned int normal_level, bool force /* = 1 */)
 
 cWaypoint* cOverworld::Get_Waypoint(const std::string& name)
 {
+    cWorld_Path_Graph* graph = Get_Path_Graph();
+
+    if (graph) {
+        int num = graph->Get_Waypoint_Num(name);
+
+        if (num < 0) {
+            return NULL;
+        }
+
+        return m_waypoints[num];
+    }
+
     for (WaypointList::iterator itr = m_waypoints.begin(); itr != m_waypoints.end(); ++itr) {
         cWaypoint* obj = (*itr);
 
@@ -746,6 +802,12 @@ int cOverworld::Get_Level_Waypoint_Num(std::string level_name)
 
 int cOverworld::Get_Waypoint_Num(const std::string& name)
 {
+    cWorld_Path_Graph* graph = Get_Path_Graph();
+
+    if (graph) {
+        return graph->Get_Waypoint_Num(name);
+    }
+
     int count = 0;
 
     // search waypoint
@@ -766,6 +828,12 @@ int cOverworld::Get_Waypoint_Num(const std::string& name)
 
 int cOverworld::Get_Waypoint_Collision(const GL_rect& rect_2)
 {
+    cWorld_Path_Graph* graph = Get_Path_Graph();
+
+    if (graph) {
+        return graph->Get_Waypoint_Collision(rect_2);
+    }
+
     int count = 0;
 
     for (WaypointList::iterator itr = m_waypoints.begin(); itr != m_waypoints.end(); ++itr) {
@@ -905,6 +973,21 @@ bool cOverworld::Is_Loaded(void) const
     return 0;
 }
 
+cWorld_Path_Graph* cOverworld::Get_Path_Graph(void)
+{
+    // objects can be moved
+    if (editor_world_enabled) {
+        m_path_graph->Invalidate();
+        return NULL;
+    }
+
+    if (!m_path_graph->Is_Built()) {
+        m_path_graph->Build();
+    }
+
+    return m_path_graph;
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 cOverworld* pActive_Overworld = NULL;
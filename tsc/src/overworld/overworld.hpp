@@ -22,6 +22,7 @@
 #include "../overworld/world_layer.hpp"
 #include "../overworld/world_player.hpp"
 #include "../overworld/world_sprite_manager.hpp"
+#include "../overworld/world_path_graph.hpp"
 #include "../gui/hud.hpp"
 #include "../audio/random_sound.hpp"
 
@@ -78,6 +79,15 @@ namespace TSC {
         /// Load an overworld from a world directory.
         /// The returned instance must be freed by you.
         static cOverworld* Load_From_Directory(boost::filesystem::path directory, int user_dir = 0);
+        /// Load only the description of an overworld from a world directory.
+        /// The world and layer files are loaded by Load_Content().
+        /// The returned instance must be freed by you.
+        static cOverworld* Load_Description_From_Directory(boost::filesystem::path directory, int user_dir = 0);
+
+        /* Load the world and layer files if not loaded yet
+         * Raises xmlpp::exception on failure and stays unloaded.
+        */
+        void Load_Content(void);
 
         virtual ~cOverworld(void);
 
@@ -175,6 +185,11 @@ namespace TSC {
         // Return true if a world is loaded
         bool Is_Loaded(void) const;
 
+        /* Return the built path graph
+         * returns NULL if the world editor is enabled as objects can move
+        */
+        cWorld_Path_Graph* Get_Path_Graph(void);
+
         // map objects
         cWorld_Sprite_Manager* m_sprite_manager;
         // animation manager
@@ -185,6 +200,8 @@ namespace TSC {
         cOverworld_description* m_description;
         // current Layer for collision checking
         cLayer* m_layer;
+        // waypoint and layer line graph
+        cWorld_Path_Graph* m_path_graph;
 
         /* *** *** *** Settings *** *** *** *** */
 
@@ -27,10 +27,11 @@ using namespace TSC;
 
 using namespace std;
 
-cOverworldLoader::cOverworldLoader()
+cOverworldLoader::cOverworldLoader(cOverworld* p_overworld /* = NULL */)
     : xmlpp::SaxParser()
 {
-    mp_overworld = NULL;
+    mp_overworld = p_overworld;
+    m_started = false;
 }
 
 cOverworldLoader::~cOverworldLoader()
@@ -56,10 +57,13 @@ void cOverworldLoader::parse_file(fs::path filename)
 
 void cOverworldLoader::on_start_document()
 {
-    if (mp_overworld)
+    if (m_started)
         throw("Restarted XML parser after already starting it."); // FIXME: proper exception
 
-    mp_overworld = new cOverworld();
+    m_started = true;
+
+    if (!mp_overworld)
+        mp_overworld = new cOverworld();
 }
 
 void cOverworldLoader::on_end_document()
@@ -38,7 +38,8 @@ namespace TSC {
     public:
         static cSprite* Create_World_Object_From_XML(const std::string& name, XmlAttributes& attributes, int engine_version, cSprite_Manager* p_sprite_manager, cOverworld* p_overworld);
 
-        cOverworldLoader();
+        // If an overworld is given it is filled instead of creating one
+        cOverworldLoader(cOverworld* p_overworld = NULL);
         virtual ~cOverworldLoader();
 
         // Parse the given world file. Use this function instead of bare xmlpp’s
@@ -67,6 +68,8 @@ namespace TSC {
 
         // The cOverworld instance this parser builds up.
         cOverworld* mp_overworld;
+        // Parsing was started
+        bool m_started;
         // The world file we’re parsing
         boost::filesystem::path m_worldfile;
         // The <property> results we found before the current tag.
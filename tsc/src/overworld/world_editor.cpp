@@ -58,6 +58,11 @@ void cEditor_World::Disable(void)
 
     cEditor::Disable();
     editor_world_enabled = false;
+
+    // objects may have been moved
+    if (mp_overworld) {
+        mp_overworld->m_path_graph->Invalidate();
+    }
 }
 
 void cEditor_World::Set_World(cOverworld* p_world)
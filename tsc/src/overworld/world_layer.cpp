@@ -225,6 +225,17 @@ GL_line cLayer_Line_Point_Start::Get_Line(void) const
 
 cWaypoint* cLayer_Line_Point_Start::Get_End_Waypoint(void) const
 {
+    cWorld_Path_Graph* graph = m_overworld->Get_Path_Graph();
+
+    // resolved when building
+    if (graph && !m_auto_destroy) {
+        int line_num = graph->Get_Line_Num(this);
+
+        if (line_num >= 0) {
+            return m_overworld->Get_Waypoint(graph->Get_End_Waypoint_Num(line_num));
+        }
+    }
+
     // get waypoint number
     int wp_num = m_overworld->Get_Waypoint_Collision(m_linked_point->m_col_rect);
 
@@ -306,6 +317,7 @@ void cLayer::Add(cLayer_Line_Point_Start* line_point)
     }
 
     cObject_Manager<cLayer_Line_Point_Start>::Add(line_point);
+    Invalidate_Path_Graph();
 
     // check if in sprite manager
     if (m_overworld->m_sprite_manager->Get_Array_Num(line_point) == -1) {
@@ -344,14 +356,39 @@ void cLayer::Save_To_File(const fs::path& path)
     debug_print("Wrote world layer file '%s'.\n", path_to_utf8(path).c_str());
 }
 
+bool cLayer::Delete(size_t array_num, bool delete_data /* = 1 */)
+{
+    Invalidate_Path_Graph();
+    return cObject_Manager<cLayer_Line_Point_Start>::Delete(array_num, delete_data);
+}
+
+bool cLayer::Delete(cLayer_Line_Point_Start* line_point, bool delete_data /* = 1 */)
+{
+    Invalidate_Path_Graph();
+    return cObject_Manager<cLayer_Line_Point_Start>::Delete(line_point, delete_data);
+}
+
 void cLayer::Delete_All(void)
 {
     // only clear array
     objects.clear();
+    Invalidate_Path_Graph();
 }
 
 cLayer_Line_Point_Start* cLayer::Get_Line_Collision_Start(const GL_rect& line_rect)
 {
+    cWorld_Path_Graph* graph = Get_Path_Graph();
+
+    if (graph) {
+        int line_num = graph->Get_Line_Start_Collision(line_rect);
+
+        if (line_num < 0) {
+            return NULL;
+        }
+
+        return objects[line_num];
+    }
+
     for (LayerLineList::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         // get pointer
         cLayer_Line_Point_Start* layer_line = (*itr);
@@ -393,6 +430,44 @@ cLine_collision cLayer::Get_Line_Collision_Direction(float x, float y, ObjectDir
 
 cLine_collision cLayer::Get_Nearest(float x, float y, ObjectDirection dir /* = DIR_HORIZONTAL */, unsigned int check_size /* = 15 */, int only_origin_id /* = -1 */) const
 {
+    cWorld_Path_Graph* graph = Get_Path_Graph();
+
+    // only check lines near the position
+    if (graph) {
+        GL_rect check_rect(x, y, 0, 0);
+
+        if (dir == DIR_HORIZONTAL) {
+            check_rect.m_x -= check_size;
+            check_rect.m_w = static_cast<float>(check_size * 2);
+        }
+        else { // vertical
+            check_rect.m_y -= check_size;
+            check_rect.m_h = static_cast<float>(check_size * 2);
+        }
+
+        vector<unsigned int> lines;
+        graph->Get_Lines(check_rect, lines);
+
+        for (vector<unsigned int>::const_iterator itr = lines.begin(); itr != lines.end(); ++itr) {
+            cLayer_Line_Point_Start* layer_line = objects[*itr];
+
+            // line is not from waypoint
+            if (only_origin_id >= 0 && only_origin_id != layer_line->m_origin) {
+                continue;
+            }
+
+            cLine_collision col = Get_Nearest_Line(layer_line, *itr, x, y, dir, check_size);
+
+            // found
+            if (col.m_line) {
+                return col;
+            }
+        }
+
+        // none found
+        return cLine_collision();
+    }
+
     for (LayerLineList::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         // get pointer
         cLayer_Line_Point_Start* layer_line = (*itr);
@@ -402,7 +477,7 @@ cLine_collision cLayer::Get_Nearest(float x, float y, ObjectDirection dir /* = D
             continue;
         }
 
-        cLine_collision col = Get_Nearest_Line(layer_line, x, y, dir, check_size);
+        cLine_collision col = Get_Nearest_Line(layer_line, itr - objects.begin(), x, y, dir, check_size);
 
         // found
         if (col.m_line) {
@@ -416,75 +491,120 @@ cLine_collision cLayer::Get_Nearest(float x, float y, ObjectDirection dir /* = D
 
 cLine_collision cLayer::Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, float x, float y, ObjectDirection dir /* = DIR_HORIZONTAL */, unsigned int check_size /* = 15  */) const
 {
-    GL_line line_1, line_2;
+    return Get_Nearest_Line(map_layer_line, Get_Array_Num(map_layer_line), x, y, dir, check_size);
+}
 
+cLine_collision cLayer::Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, int line_number, float x, float y, ObjectDirection dir, unsigned int check_size) const
+{
     // create map line
     GL_line map_line = map_layer_line->Get_Line();
 
-    // check into both directions from inside
-    for (float csize = 0; csize < check_size; csize++) {
-        line_1.m_x1 = x;
-        line_1.m_y1 = y;
-        line_1.m_x2 = x;
-        line_1.m_y2 = y;
-        line_2 = line_1;
+    // debug drawing
+    if (pOverworld_Manager->m_debug_mode && pOverworld_Manager->m_draw_layer) {
+        GL_line line_1(x, y, x, y);
+        GL_line line_2 = line_1;
 
-        // set line size
         if (dir == DIR_HORIZONTAL) {
-            line_1.m_x1 += csize;
-            line_2.m_x2 -= csize;
+            line_1.m_x2 += check_size;
+            line_2.m_x2 -= check_size;
         }
         else { // vertical
-            line_1.m_y1 += csize;
-            line_2.m_y2 -= csize;
+            line_1.m_y2 += check_size;
+            line_2.m_y2 -= check_size;
         }
 
-        // debug drawing
-        if (pOverworld_Manager->m_debug_mode && pOverworld_Manager->m_draw_layer) {
-            // create request
-            cLine_Request* line_request = new cLine_Request();
-            pVideo->Draw_Line(line_1.m_x1 - pActive_Camera->m_x, line_1.m_y1 - pActive_Camera->m_y, line_1.m_x2 - pActive_Camera->m_x, line_1.m_y2 - pActive_Camera->m_y, map_layer_line->m_pos_z + 0.001f, &white, line_request);
-            line_request->m_line_width = 2;
-            line_request->m_render_count = 50;
-            // add request
-            pRenderer->Add(line_request);
-
-            // create request
-            line_request = new cLine_Request();
-            pVideo->Draw_Line(line_2.m_x1 - pActive_Camera->m_x, line_2.m_y1 - pActive_Camera->m_y, line_2.m_x2 - pActive_Camera->m_x, line_2.m_y2 - pActive_Camera->m_y, map_layer_line->m_pos_z + 0.001f, &black, line_request);
-            line_request->m_line_width = 2;
-            line_request->m_render_count = 50;
-            // add request
-            pRenderer->Add(line_request);
+        // create request
+        cLine_Request* line_request = new cLine_Request();
+        pVideo->Draw_Line(line_1.m_x1 - pActive_Camera->m_x, line_1.m_y1 - pActive_Camera->m_y, line_1.m_x2 - pActive_Camera->m_x, line_1.m_y2 - pActive_Camera->m_y, map_layer_line->m_pos_z + 0.001f, &white, line_request);
+        line_request->m_line_width = 2;
+        line_request->m_render_count = 50;
+        // add request
+        pRenderer->Add(line_request);
+
+        // create request
+        line_request = new cLine_Request();
+        pVideo->Draw_Line(line_2.m_x1 - pActive_Camera->m_x, line_2.m_y1 - pActive_Camera->m_y, line_2.m_x2 - pActive_Camera->m_x, line_2.m_y2 - pActive_Camera->m_y, map_layer_line->m_pos_z + 0.001f, &black, line_request);
+        line_request->m_line_width = 2;
+        line_request->m_render_count = 50;
+        // add request
+        pRenderer->Add(line_request);
+    }
+
+    // position on the map line
+    float pos;
+    // signed distance to the intersection
+    float difference;
+
+    if (dir == DIR_HORIZONTAL) {
+        // parallel
+        if (map_line.m_y1 == map_line.m_y2) {
+            return cLine_collision();
         }
 
-        // check direction line 1
-        if (line_1.Intersects(&map_line)) {
-            cLine_collision col = cLine_collision();
+        pos = (y - map_line.m_y1) / (map_line.m_y2 - map_line.m_y1);
+        difference = map_line.m_x1 + (pos * (map_line.m_x2 - map_line.m_x1)) - x;
+    }
+    else { // vertical
+        // parallel
+        if (map_line.m_x1 == map_line.m_x2) {
+            return cLine_collision();
+        }
 
-            col.m_line = map_layer_line;
-            col.m_line_number = Get_Array_Num(map_layer_line);
-            col.m_difference = csize;
+        pos = (x - map_line.m_x1) / (map_line.m_x2 - map_line.m_x1);
+        difference = map_line.m_y1 + (pos * (map_line.m_y2 - map_line.m_y1)) - y;
+    }
 
-            // found
-            return col;
+    // outside the line
+    // the lower end point is excluded like in GL_line::Intersects() as it belongs to the connected line
+    if (map_line.m_y1 < map_line.m_y2) {
+        if (pos < 0.0f || pos >= 1.0f) {
+            return cLine_collision();
         }
+    }
+    else if (pos <= 0.0f || pos > 1.0f) {
+        return cLine_collision();
+    }
 
-        // check direction line 2
-        if (line_2.Intersects(&map_line)) {
-            cLine_collision col = cLine_collision();
+    // the check lines were extended pixel by pixel starting with a size of 1
+    // with a small tolerance for rounding errors on exact pixel distances
+    float size = std::max(1.0f, ceil(fabs(difference) - 0.001f));
 
-            col.m_line = map_layer_line;
-            col.m_line_number = Get_Array_Num(map_layer_line);
-            col.m_difference = -csize;
+    // too far away
+    if (size >= check_size) {
+        return cLine_collision();
+    }
 
-            // found
-            return col;
-        }
+    cLine_collision col = cLine_collision();
+
+    col.m_line = map_layer_line;
+    col.m_line_number = line_number;
+
+    if (difference >= 0.0f) {
+        col.m_difference = size;
+    }
+    else {
+        col.m_difference = -size;
     }
 
-    // not found
-    return cLine_collision();
+    // found
+    return col;
+}
+
+cWorld_Path_Graph* cLayer::Get_Path_Graph(void) const
+{
+    // a layer which is not loaded yet
+    if (m_overworld->m_layer != this) {
+        return NULL;
+    }
+
+    return m_overworld->Get_Path_Graph();
+}
+
+void cLayer::Invalidate_Path_Graph(void)
+{
+    if (m_overworld->m_path_graph) {
+        m_overworld->m_path_graph->Invalidate();
+    }
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
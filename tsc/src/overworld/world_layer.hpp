@@ -21,6 +21,7 @@
 #include "../objects/movingsprite.hpp"
 #include "../core/obj_manager.hpp"
 #include "../overworld/world_waypoint.hpp"
+#include "../overworld/world_path_graph.hpp"
 
 namespace TSC {
 
@@ -129,6 +130,9 @@ namespace TSC {
 
         // Add a layer line
         virtual void Add(cLayer_Line_Point_Start* line_point);
+        // Delete a layer line
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        virtual bool Delete(cLayer_Line_Point_Start* line_point, bool delete_data = 1);
 
         // Save to file, raises xmlpp::exception on failure
         void Save_To_File(const boost::filesystem::path& filename);
@@ -150,11 +154,21 @@ namespace TSC {
          * if only_origin_id is set only checks lines with the given id
         */
         cLine_collision Get_Nearest(float x, float y, ObjectDirection dir = DIR_HORIZONTAL, unsigned int check_size = 15, int only_origin_id = -1) const;
-        // Return the collision data between the given line and position
+        /* Return the collision data between the given line and position
+         * the distance along the direction is calculated from the line intersection
+        */
         cLine_collision Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, float x, float y, ObjectDirection dir = DIR_HORIZONTAL, unsigned int check_size = 15) const;
 
         // parent overworld
         cOverworld* m_overworld;
+
+    private:
+        // Get_Nearest_Line() with the known line array number
+        cLine_collision Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, int line_number, float x, float y, ObjectDirection dir, unsigned int check_size) const;
+        // Return the overworld path graph if usable for this layer
+        cWorld_Path_Graph* Get_Path_Graph(void) const;
+        // Rebuild the overworld path graph on the next use
+        void Invalidate_Path_Graph(void);
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -105,7 +105,7 @@ void cOverworld_Manager::Load_Dir(const fs::path& dir, bool user_dir /* = false
                     continue;
                 }
 
-                overworld = cOverworld::Load_From_Directory(current_dir, user_dir);
+                overworld = cOverworld::Load_Description_From_Directory(current_dir, user_dir);
                 objects.push_back(overworld);
             }
         }
@@ -115,6 +115,23 @@ void cOverworld_Manager::Load_Dir(const fs::path& dir, bool user_dir /* = false
     }
 }
 
+bool cOverworld_Manager::Load(cOverworld* world)
+{
+    try {
+        world->Load_Content();
+    }
+    catch (const std::exception& ex) {
+        cerr << path_to_utf8(world->m_description->m_path) << " " << ex.what() << endl;
+        return 0;
+    }
+    catch (const char* ex) {
+        cerr << path_to_utf8(world->m_description->m_path) << " " << ex << endl;
+        return 0;
+    }
+
+    return 1;
+}
+
 bool cOverworld_Manager::Set_Active(const std::string& str)
 {
     return Set_Active(Get(str));
@@ -122,7 +139,7 @@ bool cOverworld_Manager::Set_Active(const std::string& str)
 
 bool cOverworld_Manager::Set_Active(cOverworld* world)
 {
-    if (!world) {
+    if (!world || !Load(world)) {
         return 0;
     }
 
@@ -170,11 +187,15 @@ cOverworld* cOverworld_Manager::Get(const std::string& str)
 {
     cOverworld* world = Get_from_Name(str);
 
-    if (world) {
-        return world;
+    if (!world) {
+        world = Get_from_Path(utf8_to_path(str));
+    }
+
+    if (!world || !Load(world)) {
+        return NULL;
     }
 
-    return Get_from_Path(utf8_to_path(str));
+    return world;
 }
 
 cOverworld* cOverworld_Manager::Get_from_Path(const fs::path& path)
@@ -37,17 +37,21 @@ namespace TSC {
         */
         bool New(std::string name);
 
-        // Load all overworlds
-        // todo : should only load overworld info
+        // Load the descriptions of all overworlds
         void Init(void);
-        /* Load overworlds from the given directory
+        /* Load overworld descriptions from the given directory
+         * the world content is loaded on first use
          * user_dir : if set overrides game worlds
         */
         void Load_Dir(const boost::filesystem::path& dir, bool user_dir = false);
+        /* Load the world content if not loaded yet
+         * returns false if loading failed
+        */
+        bool Load(cOverworld* world);
 
         // Set active Overworld from name or path
         bool Set_Active(const std::string& str);
-        // Set active Overworld
+        // Set active Overworld and load it if needed
         bool Set_Active(cOverworld* world);
 
         // Reset to default world first Waypoint
@@ -55,12 +59,13 @@ namespace TSC {
 
         // Get overworld pointer. First tries to use Get_From_Name(), and
         // if that doesn’t succeed, converts `str' to a boost::filesystem::path
-        // and tries Get_From_Path.
+        // and tries Get_From_Path. The overworld is loaded if needed and
+        // NULL is returned if that fails.
         cOverworld* Get(const std::string& str);
         // Get overworld from path (may either be a full path or just
-        // a directory name)
+        // a directory name). It may only have the description loaded.
         cOverworld* Get_from_Path(const boost::filesystem::path& path);
-        // Get overworld from name
+        // Get overworld from name. It may only have the description loaded.
         cOverworld* Get_from_Name(const std::string& name);
 
         // Return overworld array number
@@ -0,0 +1,236 @@
+/***************************************************************************
+ * world_path_graph.cpp - overworld waypoint and line lookup
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../overworld/world_path_graph.hpp"
+#include "../overworld/overworld.hpp"
+#include "../overworld/world_layer.hpp"
+#include "../overworld/world_waypoint.hpp"
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cWorld_Path_Graph *** *** *** *** *** *** *** *** *** *** */
+
+const float cWorld_Path_Graph::m_cell_size = 128.0f;
+
+cWorld_Path_Graph::cWorld_Path_Graph(cOverworld* overworld)
+{
+    m_overworld = overworld;
+    m_built = 0;
+}
+
+cWorld_Path_Graph::~cWorld_Path_Graph(void)
+{
+    //
+}
+
+void cWorld_Path_Graph::Build(void)
+{
+    Invalidate();
+
+    const WaypointList& waypoints = m_overworld->m_waypoints;
+
+    for (unsigned int i = 0; i < waypoints.size(); i++) {
+        // keeps the first one
+        m_waypoint_names.insert(std::make_pair(waypoints[i]->m_destination, static_cast<int>(i)));
+        Grid_Add(m_waypoint_grid, waypoints[i]->m_rect, i);
+    }
+
+    const LayerLineList& lines = m_overworld->m_layer->objects;
+
+    for (unsigned int i = 0; i < lines.size(); i++) {
+        cLayer_Line_Point_Start* line = lines[i];
+        GL_line points = line->Get_Line();
+
+        m_line_nums.insert(std::make_pair(line, i));
+        Grid_Add(m_line_grid, GL_rect(std::min(points.m_x1, points.m_x2), std::min(points.m_y1, points.m_y2), fabs(points.m_x2 - points.m_x1), fabs(points.m_y2 - points.m_y1)), i);
+        Grid_Add(m_line_start_grid, line->m_col_rect, i);
+    }
+
+    // not resolved yet
+    m_line_end_waypoints.assign(lines.size(), -2);
+
+    for (unsigned int i = 0; i < lines.size(); i++) {
+        Resolve_End_Waypoint_Num(i);
+    }
+
+    m_built = 1;
+}
+
+void cWorld_Path_Graph::Invalidate(void)
+{
+    m_built = 0;
+
+    m_waypoint_names.clear();
+    m_line_nums.clear();
+    m_line_end_waypoints.clear();
+    m_waypoint_grid.clear();
+    m_line_grid.clear();
+    m_line_start_grid.clear();
+}
+
+bool cWorld_Path_Graph::Is_Built(void) const
+{
+    return m_built;
+}
+
+int cWorld_Path_Graph::Get_Waypoint_Num(const std::string& destination) const
+{
+    std::unordered_map<std::string, int>::const_iterator itr = m_waypoint_names.find(destination);
+
+    if (itr == m_waypoint_names.end()) {
+        return -1;
+    }
+
+    return itr->second;
+}
+
+int cWorld_Path_Graph::Get_Waypoint_Collision(const GL_rect& rect) const
+{
+    vector<unsigned int> nums;
+    Grid_Get(m_waypoint_grid, rect, nums);
+
+    for (vector<unsigned int>::const_iterator itr = nums.begin(); itr != nums.end(); ++itr) {
+        if (rect.Intersects(m_overworld->m_waypoints[*itr]->m_rect)) {
+            return *itr;
+        }
+    }
+
+    return -1;
+}
+
+int cWorld_Path_Graph::Get_Line_Start_Collision(const GL_rect& rect) const
+{
+    vector<unsigned int> nums;
+    Grid_Get(m_line_start_grid, rect, nums);
+
+    for (vector<unsigned int>::const_iterator itr = nums.begin(); itr != nums.end(); ++itr) {
+        if (rect.Intersects(m_overworld->m_layer->objects[*itr]->m_col_rect)) {
+            return *itr;
+        }
+    }
+
+    return -1;
+}
+
+int cWorld_Path_Graph::Get_Line_Num(const cLayer_Line_Point_Start* line) const
+{
+    std::unordered_map<const cLayer_Line_Point_Start*, unsigned int>::const_iterator itr = m_line_nums.find(line);
+
+    if (itr == m_line_nums.end()) {
+        return -1;
+    }
+
+    return itr->second;
+}
+
+int cWorld_Path_Graph::Get_End_Waypoint_Num(unsigned int line_num) const
+{
+    if (line_num >= m_line_end_waypoints.size()) {
+        return -1;
+    }
+
+    return m_line_end_waypoints[line_num];
+}
+
+void cWorld_Path_Graph::Get_Lines(const GL_rect& rect, vector<unsigned int>& lines) const
+{
+    Grid_Get(m_line_grid, rect, lines);
+}
+
+void cWorld_Path_Graph::Grid_Add(GridMap& grid, const GL_rect& rect, unsigned int num)
+{
+    const int32_t start_x = static_cast<int32_t>(floor(rect.m_x / m_cell_size));
+    const int32_t start_y = static_cast<int32_t>(floor(rect.m_y / m_cell_size));
+    const int32_t end_x = static_cast<int32_t>(floor((rect.m_x + rect.m_w) / m_cell_size));
+    const int32_t end_y = static_cast<int32_t>(floor((rect.m_y + rect.m_h) / m_cell_size));
+
+    for (int32_t y = start_y; y <= end_y; y++) {
+        for (int32_t x = start_x; x <= end_x; x++) {
+            grid[(static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y)].push_back(num);
+        }
+    }
+}
+
+void cWorld_Path_Graph::Grid_Get(const GridMap& grid, const GL_rect& rect, vector<unsigned int>& nums) const
+{
+    nums.clear();
+
+    const int32_t start_x = static_cast<int32_t>(floor(rect.m_x / m_cell_size));
+    const int32_t start_y = static_cast<int32_t>(floor(rect.m_y / m_cell_size));
+    const int32_t end_x = static_cast<int32_t>(floor((rect.m_x + rect.m_w) / m_cell_size));
+    const int32_t end_y = static_cast<int32_t>(floor((rect.m_y + rect.m_h) / m_cell_size));
+
+    for (int32_t y = start_y; y <= end_y; y++) {
+        for (int32_t x = start_x; x <= end_x; x++) {
+            GridMap::const_iterator itr = grid.find((static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y));
+
+            if (itr != grid.end()) {
+                nums.insert(nums.end(), itr->second.begin(), itr->second.end());
+            }
+        }
+    }
+
+    // objects in several cells
+    std::sort(nums.begin(), nums.end());
+    nums.erase(std::unique(nums.begin(), nums.end()), nums.end());
+}
+
+void cWorld_Path_Graph::Resolve_End_Waypoint_Num(unsigned int line_num)
+{
+    // lines on the way to the end Waypoint
+    vector<unsigned int> path;
+    int wp_num = -1;
+
+    while (1) {
+        // already resolved
+        if (m_line_end_waypoints[line_num] != -2) {
+            // circular lines have no end
+            if (m_line_end_waypoints[line_num] != -3) {
+                wp_num = m_line_end_waypoints[line_num];
+            }
+
+            break;
+        }
+
+        // mark as visited
+        m_line_end_waypoints[line_num] = -3;
+        path.push_back(line_num);
+
+        const GL_rect& end_rect = m_overworld->m_layer->objects[line_num]->m_linked_point->m_col_rect;
+        wp_num = Get_Waypoint_Collision(end_rect);
+
+        if (wp_num >= 0) {
+            break;
+        }
+
+        int next_line_num = Get_Line_Start_Collision(end_rect);
+
+        // no line to follow
+        if (next_line_num < 0) {
+            break;
+        }
+
+        line_num = next_line_num;
+    }
+
+    for (vector<unsigned int>::const_iterator itr = path.begin(); itr != path.end(); ++itr) {
+        m_line_end_waypoints[*itr] = wp_num;
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
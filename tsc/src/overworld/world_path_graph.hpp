@@ -0,0 +1,107 @@
+/***************************************************************************
+ * world_path_graph.hpp - overworld waypoint and line lookup
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_WORLD_PATH_GRAPH_HPP
+#define TSC_WORLD_PATH_GRAPH_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/math/rect.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cWorld_Path_Graph *** *** *** *** *** *** *** *** *** *** */
+
+    class cOverworld;
+    class cLayer_Line_Point_Start;
+
+    /* Waypoint and layer line graph of an overworld
+     *
+     * Indexes the waypoints by destination and the waypoints, lines and
+     * line start points by position in a uniform grid. The waypoint at
+     * the end of each line is resolved once when building, following
+     * connected lines.
+     *
+     * All results are array numbers in cOverworld::m_waypoints and the
+     * layer objects. If several objects match the lowest number is
+     * returned like a linear scan would.
+     *
+     * The graph does not notice objects being moved. It must be
+     * invalidated when waypoints or lines change and is not used while
+     * the world editor is enabled.
+    */
+    class cWorld_Path_Graph {
+    public:
+        cWorld_Path_Graph(cOverworld* overworld);
+        ~cWorld_Path_Graph(void);
+
+        // Build from the current waypoints and layer lines
+        void Build(void);
+        // Rebuild on the next use
+        void Invalidate(void);
+        // Returns true if built and not invalidated
+        bool Is_Built(void) const;
+
+        // Return the number of the first Waypoint with the given destination or -1
+        int Get_Waypoint_Num(const std::string& destination) const;
+        // Return the number of the first Waypoint colliding with the rect or -1
+        int Get_Waypoint_Collision(const GL_rect& rect) const;
+        // Return the number of the first line with its start point colliding with the rect or -1
+        int Get_Line_Start_Collision(const GL_rect& rect) const;
+        // Return the array number of the line or -1
+        int Get_Line_Num(const cLayer_Line_Point_Start* line) const;
+        /* Return the Waypoint number at the end of the line or -1
+         * if the line continues on another line it is followed to the end
+        */
+        int Get_End_Waypoint_Num(unsigned int line_num) const;
+        // Set the numbers of all lines with bounds touching the rect sorted ascending
+        void Get_Lines(const GL_rect& rect, vector<unsigned int>& lines) const;
+
+        // grid cell size
+        static const float m_cell_size;
+
+    private:
+        typedef std::unordered_map<uint64_t, vector<unsigned int> > GridMap;
+
+        // Add the object number to all cells touching the rect
+        void Grid_Add(GridMap& grid, const GL_rect& rect, unsigned int num);
+        // Set the numbers from all cells touching the rect sorted ascending
+        void Grid_Get(const GridMap& grid, const GL_rect& rect, vector<unsigned int>& nums) const;
+        // Resolve the end Waypoint of the line and all lines followed
+        void Resolve_End_Waypoint_Num(unsigned int line_num);
+
+        cOverworld* m_overworld;
+        bool m_built;
+
+        // first Waypoint number by destination
+        std::unordered_map<std::string, int> m_waypoint_names;
+        // line number by line
+        std::unordered_map<const cLayer_Line_Point_Start*, unsigned int> m_line_nums;
+        // end Waypoint number by line number
+        // -2 if not resolved and -3 while resolving
+        vector<int> m_line_end_waypoints;
+
+        // Waypoint rects
+        GridMap m_waypoint_grid;
+        // line bounds
+        GridMap m_line_grid;
+        // line start point rects
+        GridMap m_line_start_grid;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -36,8 +36,12 @@ void cEvent::Fire(cMRuby_Interpreter* p_mruby, Scripting::cScriptable_Object* p_
         return;
     mrb_state* p_state = p_mruby->Get_MRuby_State();
 
-    // Iterate through the list of callbacks and execute them
+    // Skip the handler lookup for objects without handlers for this event
     std::string evtname = Event_Name();
+    if (!p_obj->may_have_event_handlers(cScriptable_Object::event_bit(evtname)))
+        return;
+
+    // Iterate through the list of callbacks and execute them
     std::vector<mrb_value>::iterator start = p_obj->event_handlers_begin(evtname);
     std::vector<mrb_value>::iterator end = p_obj->event_handlers_end(evtname);
 
@@ -19,6 +19,8 @@
 using namespace TSC;
 using namespace TSC::Scripting;
 
+const uint32_t cTouch_Event::m_event_bit = cScriptable_Object::event_bit("touch");
+
 cTouch_Event::cTouch_Event(cSprite* p_collided)
 {
     mp_collided = p_collided;
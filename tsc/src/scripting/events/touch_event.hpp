@@ -24,6 +24,9 @@ namespace TSC {
             cTouch_Event(cSprite* p_collided);
             virtual std::string Event_Name();
             cSprite* Get_Collided();
+
+            // cScriptable_Object::event_bit() of the "touch" event
+            static const uint32_t m_event_bit;
         protected:
             virtual void Run_MRuby_Callback(cMRuby_Interpreter* p_mruby, mrb_value callback);
         private:
@@ -148,7 +148,7 @@ static mrb_value Get_Kill_Sound(mrb_state* p_state,  mrb_value self)
 {
     cEnemy* p_enemy = Get_Data_Ptr<cEnemy>(p_state, self);
 
-    return mrb_str_new_cstr(p_state, p_enemy->m_kill_sound.c_str());
+    return mrb_str_new_cstr(p_state, p_enemy->m_kill_sound.Get_Filename().c_str());
 }
 
 /**
@@ -61,16 +61,8 @@ static mrb_value Require(mrb_state* p_state, mrb_value self)
     if (path.is_absolute())
         mrb_raise(p_state, MRB_ARGUMENT_ERROR(p_state), "Absolute paths are not allowed.");
 
-    // Open the MRuby file for reading
     fs::path scriptfile = pPackage_Manager->Get_Scripting_Path(cpackage ? cpackage : "", spath);
-    fs::ifstream file(scriptfile);
     debug_print("require: Loading '%s'\n", path_to_utf8(scriptfile).c_str());
-    if (!file.is_open())
-        mrb_raisef(p_state, MRB_RUNTIME_ERROR(p_state), "Cannot open file '%s' for reading", scriptfile.generic_string().c_str());
-
-    // Read it
-    std::string code = readfile(file);
-    file.close();
 
     // Create our context for exception handling
     mrbc_context* p_context = mrbc_context_new(p_state);
@@ -78,8 +70,11 @@ static mrb_value Require(mrb_state* p_state, mrb_value self)
     p_context->lineno = 1;
     mrbc_filename(p_state, p_context, path_to_utf8(scriptfile.filename()).c_str());
 
-    // Compile and run the MRuby code
-    mrb_load_nstring_cxt(p_state, code.c_str(), code.length(), p_context);
+    // Compile (or load the precompiled bytecode) and run the MRuby code
+    if (!Scripting::Load_File(p_state, scriptfile, p_context)) {
+        mrbc_context_free(p_state, p_context);
+        mrb_raisef(p_state, MRB_RUNTIME_ERROR(p_state), "Cannot open file '%s' for reading", scriptfile.generic_string().c_str());
+    }
 
     // Check for exceptions
     if (p_state->exc)
@@ -511,6 +511,7 @@ static mrb_value Warp(mrb_state* p_state, mrb_value self)
     mrb_get_args(p_state, "ii", &x, &y);
 
     p_sprite->Set_Pos(x, y);
+    p_sprite->Wake_Up();
 
     return mrb_nil_value();
 }
@@ -537,6 +538,7 @@ static mrb_value Start_At(mrb_state* p_state, mrb_value self)
     mrb_get_args(p_state, "ii", &start_x, &start_y);
 
     p_sprite->Set_Pos(start_x, start_y, true);
+    p_sprite->Wake_Up();
 
     return mrb_nil_value();
 }
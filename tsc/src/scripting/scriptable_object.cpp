@@ -40,7 +40,7 @@ using namespace TSC::Scripting;
 
 cScriptable_Object::cScriptable_Object()
 {
-    //
+    m_event_mask = 0;
 }
 
 cScriptable_Object::~cScriptable_Object()
@@ -74,10 +74,24 @@ cScriptable_Object::~cScriptable_Object()
  */
 void cScriptable_Object::clear_event_handlers(const std::string& levelname /* = "" */)
 {
-    if (levelname.empty())
+    if (levelname.empty()) {
         m_callbacks.clear();
-    else
-        m_callbacks[levelname].clear();
+        m_event_mask = 0;
+        return;
+    }
+
+    m_callbacks[levelname].clear();
+
+    // rebuild the mask from the remaining levels
+    m_event_mask = 0;
+    std::map<std::string, std::map<std::string, std::vector<mrb_value> > >::const_iterator level_itr;
+    std::map<std::string, std::vector<mrb_value> >::const_iterator evt_itr;
+    for (level_itr = m_callbacks.begin(); level_itr != m_callbacks.end(); ++level_itr) {
+        for (evt_itr = level_itr->second.begin(); evt_itr != level_itr->second.end(); ++evt_itr) {
+            if (!evt_itr->second.empty())
+                m_event_mask |= event_bit(evt_itr->first);
+        }
+    }
 }
 
 /**
@@ -95,6 +109,18 @@ void cScriptable_Object::clear_event_handlers(const std::string& levelname /* =
 void cScriptable_Object::register_event_handler(const std::string& evtname, mrb_value callback)
 {
     m_callbacks[get_active_level_name()][evtname].push_back(callback);
+    m_event_mask |= event_bit(evtname);
+}
+
+/**
+ * Bit representing the given event name in the mask of events
+ * this object has handlers for. The bit is derived from a hash of
+ * the name, so different events may share a bit; a set bit only
+ * tells that handlers may exist, a cleared one that none do.
+ */
+uint32_t cScriptable_Object::event_bit(const std::string& evtname)
+{
+    return 1u << (std::hash<std::string>()(evtname) % 32);
 }
 
 /**
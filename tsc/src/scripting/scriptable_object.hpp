@@ -34,11 +34,22 @@ namespace TSC {
             std::vector<mrb_value>::iterator event_handlers_begin(const std::string& evtname);
             std::vector<mrb_value>::iterator event_handlers_end(const std::string& evtname);
 
+            // Bit representing `evtname' in the event handler mask.
+            static uint32_t event_bit(const std::string& evtname);
+            // Whether handlers for the event with the given bit may be
+            // registered. If not, firing the event can be skipped.
+            inline bool may_have_event_handlers(uint32_t evtbit) const
+            {
+                return (m_event_mask & evtbit) != 0;
+            }
+
         protected:
             /// Mapping of level + event names and registered callbacks.
             /// Example in ruby syntax:
             /// {"mylevel" => {"myevent" => [handle1, handle2]}, "mevent2" => ["handle3"]}
             std::map<std::string, std::map<std::string, std::vector<mrb_value> > > m_callbacks;
+            /// Event bits of all events with registered handlers in any level.
+            uint32_t m_event_mask;
         private:
             std::string get_active_level_name();
         };
@@ -21,6 +21,7 @@
 #include "../audio/audio.hpp"
 #include "../user/savegame/savegame.hpp"
 #include "../input/keyboard.hpp"
+#include "events/touch_event.hpp"
 
 #include "objects/mrb_tsc.hpp"
 #include "objects/mrb_eventable.hpp"
@@ -86,11 +87,131 @@ namespace TSC {
 
 namespace Scripting {
 
+// Bytecode of the scripts compiled by Load_Code(), keyed by the
+// context filename (or the script path for Load_File()). Each key
+// only keeps the most recently compiled script, so the cache is
+// bounded by the number of distinct script names. The dumped irep
+// does not depend on the mrb_state, so it survives interpreter
+// restarts.
+struct cCached_Bytecode
+{
+    std::string m_code;
+    std::vector<uint8_t> m_bytecode;
+};
+
+static std::unordered_map<std::string, cCached_Bytecode> g_bytecode_cache;
+
+/* Run the given bytecode. Returns false without running anything if
+ * this mruby cannot read it (e.g. a .mrb file from another mruby
+ * version), the caller is expected to compile the source instead.
+ */
+static bool Load_Bytecode(mrb_state* p_state, const std::vector<uint8_t>& bytecode, mrbc_context* p_context, mrb_value& result)
+{
+    if (bytecode.empty())
+        return false;
+
+    mrb_irep* p_irep = mrb_read_irep(p_state, &bytecode[0]);
+    if (!p_irep)
+        return false;
+    mrb_irep_decref(p_state, p_irep);
+
+    result = mrb_load_irep_cxt(p_state, &bytecode[0], p_context);
+    return true;
+}
+
+static mrb_value Load_Code_Cached(mrb_state* p_state, const std::string& key, const std::string& code, mrbc_context* p_context)
+{
+    mrb_value result;
+
+    std::unordered_map<std::string, cCached_Bytecode>::iterator iter = g_bytecode_cache.find(key);
+    if (iter != g_bytecode_cache.end()) {
+        if (iter->second.m_code == code && Load_Bytecode(p_state, iter->second.m_bytecode, p_context, result))
+            return result;
+
+        // outdated or unusable
+        g_bytecode_cache.erase(iter);
+    }
+
+    int arena = mrb_gc_arena_save(p_state);
+    struct mrb_parser_state* p_parser = mrb_parse_nstring(p_state, code.c_str(), code.length(), p_context);
+    struct RProc* p_proc = NULL;
+    if (p_parser && p_parser->nerr == 0)
+        p_proc = mrb_generate_code(p_state, p_parser);
+    if (p_parser)
+        mrb_parser_free(p_parser);
+
+    uint8_t* p_bin = NULL;
+    size_t bin_size = 0;
+    if (!p_proc || mrb_dump_irep(p_state, p_proc->body.irep, 1, &p_bin, &bin_size) != MRB_DUMP_OK) {
+        // Let mruby compile it again and report the error as usual
+        mrb_gc_arena_restore(p_state, arena);
+        return mrb_load_nstring_cxt(p_state, code.c_str(), code.length(), p_context);
+    }
+
+    cCached_Bytecode& cached = g_bytecode_cache[key];
+    cached.m_code = code;
+    cached.m_bytecode.assign(p_bin, p_bin + bin_size);
+    mrb_free(p_state, p_bin);
+    mrb_gc_arena_restore(p_state, arena);
+
+    if (Load_Bytecode(p_state, cached.m_bytecode, p_context, result))
+        return result;
+
+    g_bytecode_cache.erase(key);
+    return mrb_load_nstring_cxt(p_state, code.c_str(), code.length(), p_context);
+}
+
+mrb_value Load_Code(mrb_state* p_state, const std::string& code, mrbc_context* p_context)
+{
+    return Load_Code_Cached(p_state, p_context && p_context->filename ? p_context->filename : "", code, p_context);
+}
+
+bool Load_File(mrb_state* p_state, const boost::filesystem::path& filepath, mrbc_context* p_context)
+{
+    // Prefer the bytecode precompiled by the build system
+    boost::filesystem::path bytecodepath = filepath;
+    bytecodepath.replace_extension(".mrb");
+
+    boost::system::error_code ec;
+    std::time_t script_time = boost::filesystem::last_write_time(filepath, ec);
+    if (ec)
+        script_time = 0;
+    std::time_t bytecode_time = boost::filesystem::last_write_time(bytecodepath, ec);
+
+    if (!ec && bytecode_time >= script_time) {
+        boost::filesystem::ifstream file(bytecodepath, ios::in | ios::binary);
+        if (file.is_open()) {
+            std::vector<uint8_t> bytecode((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            file.close();
+
+            mrb_value result;
+            if (Load_Bytecode(p_state, bytecode, p_context, result))
+                return true;
+
+            cerr << "Warning : Ignoring unreadable mruby bytecode '" << path_to_utf8(bytecodepath) << "'" << endl;
+        }
+    }
+
+    // Note we cannot use mrb_load_file(), because we use boost::filesystem’s
+    // filereading capabilities which mruby doesn’t understand. Instead, we
+    // simply pass the read file’s contents to mruby.
+    boost::filesystem::ifstream file(filepath);
+    if (!file.is_open())
+        return false;
+
+    std::string code = readfile(file);
+    file.close();
+
+    Load_Code_Cached(p_state, path_to_utf8(filepath), code, p_context);
+    return true;
+}
+
 cMRuby_Interpreter::cMRuby_Interpreter(cLevel* p_level)
 {
     // Set member variables
     mp_level = p_level;
     mp_mruby = mrb_open();
+    m_touch_delete_count = 0;
 
     // Load TSC classes into mruby
     Load_Wrappers();
@@ -138,6 +259,65 @@ cMRuby_Interpreter::~cMRuby_Interpreter()
     mrb_close(mp_mruby);
 }
 
+void cMRuby_Interpreter::Queue_Touch_Event(cSprite* p_sprite, cSprite* p_collided)
+{
+    // Objects nobody listens to never reach mruby
+    uint32_t evtbit = cTouch_Event::m_event_bit;
+    if (!p_sprite->may_have_event_handlers(evtbit) && !p_collided->may_have_event_handlers(evtbit))
+        return;
+
+    if (m_touch_events.empty())
+        m_touch_delete_count = cSprite_Manager::m_delete_count;
+
+    Touch touch;
+    touch.mp_sprite = p_sprite;
+    touch.mp_collided = p_collided;
+    touch.m_sprite_uid = p_sprite->m_uid;
+    touch.m_collided_uid = p_collided->m_uid;
+    m_touch_events.push_back(touch);
+}
+
+void cMRuby_Interpreter::Fire_Touch_Events()
+{
+    if (m_touch_events.empty())
+        return;
+
+    // handlers may cause new collisions, these wait for the next call
+    std::vector<Touch> touch_events;
+    touch_events.swap(m_touch_events);
+
+    // sprites were deleted since queuing
+    bool validate = m_touch_delete_count != cSprite_Manager::m_delete_count;
+
+    for (std::vector<Touch>::const_iterator itr = touch_events.begin(); itr != touch_events.end(); ++itr) {
+        const Touch& touch = *itr;
+
+        if (validate && (!Is_Touch_Sprite_Valid(touch.mp_sprite, touch.m_sprite_uid) || !Is_Touch_Sprite_Valid(touch.mp_collided, touch.m_collided_uid))) {
+            continue;
+        }
+
+        // Fire the event for both objects, eases registering
+        cTouch_Event evt1(touch.mp_collided);
+        cTouch_Event evt2(touch.mp_sprite);
+        evt1.Fire(this, touch.mp_sprite);
+        evt2.Fire(this, touch.mp_collided);
+    }
+
+    // keep the buffer for the next frame
+    if (m_touch_events.empty()) {
+        touch_events.clear();
+        m_touch_events.swap(touch_events);
+    }
+}
+
+bool cMRuby_Interpreter::Is_Touch_Sprite_Valid(cSprite* p_sprite, int uid) const
+{
+    if (p_sprite == pActive_Player)
+        return 1;
+
+    return mp_level->m_sprite_manager->Get_by_UID(uid) == p_sprite;
+}
+
 mrb_state* cMRuby_Interpreter::Get_MRuby_State()
 {
     return mp_mruby;
@@ -150,7 +330,7 @@ cLevel* cMRuby_Interpreter::Get_Level()
 
 mrb_value cMRuby_Interpreter::Run_Code_In_Context(const std::string& code, mrbc_context* p_context)
 {
-    return mrb_load_nstring_cxt(mp_mruby, code.c_str(), code.length(), p_context);
+    return Load_Code(mp_mruby, code, p_context);
 }
 
 bool cMRuby_Interpreter::Run_Code(const std::string& code, const std::string& contextname)
@@ -180,23 +360,26 @@ bool cMRuby_Interpreter::Run_Code(const std::string& code, const std::string& co
 
 bool cMRuby_Interpreter::Run_File(const boost::filesystem::path& filepath)
 {
-    // Note we cannot use mrb_load_file(), because we use boost::filesystem’s
-    // filereading capabilities which mruby doesn’t understand. Instead, we
-    // simply pass the read file’s contents to mruby.
+    mrbc_context* p_context = mrbc_context_new(mp_mruby);
+    p_context->capture_errors = true;
+    p_context->lineno = 1;
+    mrbc_filename(mp_mruby, p_context, path_to_utf8(filepath.filename()).c_str());
 
-    // Open the file.
-    boost::filesystem::ifstream file(filepath);
-    if (!file.is_open()) {
+    bool result;
+    if (!Load_File(mp_mruby, filepath, p_context)) {
         cerr << "Failed to open mruby script file '" << path_to_utf8(filepath) << "'" << endl;
-        return false;
+        result = false;
     }
+    else if (mp_mruby->exc) {
+        // Exception occured
+        mrb_print_error(mp_mruby);
+        result = false;
+    }
+    else
+        result = true;
 
-    // Read it.
-    std::string code = readfile(file);
-    file.close();
-
-    // Compile & execute it.
-    return Run_Code(code, path_to_utf8(filepath.filename()).c_str());
+    mrbc_context_free(mp_mruby, p_context);
+    return result;
 }
 
 void cMRuby_Interpreter::Load_Scripts()
@@ -57,6 +57,26 @@ namespace TSC {
             return p_result;
         }
 
+        /**
+         * Compile and run `code' in the given parsing context. The
+         * generated bytecode is cached process-wide, one script per
+         * context filename, so running the same script in a later
+         * interpreter (e.g. on level reinitialisation) skips parsing
+         * and code generation. Different code under the same name
+         * replaces the cached entry. Scripts with syntax errors are
+         * never cached and behave exactly like mrb_load_nstring_cxt().
+         */
+        mrb_value Load_Code(mrb_state* p_state, const std::string& code, mrbc_context* p_context);
+
+        /**
+         * Run the mruby script at `filepath' in the given parsing
+         * context. If a precompiled `.mrb' file not older than
+         * the script lies next to it, that bytecode is loaded
+         * instead, unless this mruby cannot read it. Returns false
+         * if neither file could be read.
+         */
+        bool Load_File(mrb_state* p_state, const boost::filesystem::path& filepath, mrbc_context* p_context);
+
         class cMRuby_Interpreter {
         public:
             // Create a new MRuby instance for the given level.
@@ -77,7 +97,7 @@ namespace TSC {
             // Execute MRuby code in the given parsing context.
             // This method only does raw code execution, no
             // exception inspection is done for you. It’s basically
-            // a wrapper around mrb_load_nstring_cxt().
+            // a wrapper around Load_Code().
             mrb_value Run_Code_In_Context(const std::string& code, mrbc_context* p_context);
             // Registers an MRuby callback to be called on the next
             // call to Evaluate_Timer_Callbacks(). `callback'
@@ -87,6 +107,12 @@ namespace TSC {
             // Runs all callbacks whose timers have fired.
             // This method is threadsafe.
             void Evaluate_Timer_Callbacks();
+            // Queues the touch event of a collision between the two
+            // sprites, fired for both of them by Fire_Touch_Events().
+            void Queue_Touch_Event(cSprite* p_sprite, cSprite* p_collided);
+            // Fires the touch events queued since the last call.
+            // Only call this while our level is the active one.
+            void Fire_Touch_Events();
             // Returns the underlying mrb_state*.
             mrb_state* Get_MRuby_State();
             // Returns the cLevel* we’re associated with.
@@ -115,6 +141,19 @@ namespace TSC {
             boost::mutex m_callback_mutex;
             std::map<std::string, struct RClass*> m_classes;
 
+            struct Touch {
+                cSprite* mp_sprite;
+                cSprite* mp_collided;
+                int m_sprite_uid;
+                int m_collided_uid;
+            };
+            std::vector<Touch> m_touch_events;
+            // cSprite_Manager::m_delete_count when the first touch was queued
+            uint32_t m_touch_delete_count;
+
+            // Whether the queued sprite still exists in our level.
+            bool Is_Touch_Sprite_Valid(cSprite* p_sprite, int uid) const;
+
             // Load all MRuby wrapper classes for the C++ classes
             // into the given mruby state.
             void Load_Wrappers();
@@ -57,6 +57,8 @@ const uint8_t cPreferences::m_video_screen_bpp_default = 32;
 */
 const bool cPreferences::m_video_vsync_default = 0;
 const uint16_t cPreferences::m_video_fps_limit_default = 240;
+// least recently drawn textures are deleted above it
+const uint16_t cPreferences::m_video_texture_budget_default = 512;
 // default geometry detail is medium
 const float cPreferences::m_geometry_quality_default = 0.5f;
 // default texture detail is high
@@ -101,6 +103,8 @@ const uint8_t cPreferences::m_joy_button_exit_default = 4;
 const bool cPreferences::m_editor_mouse_auto_hide_default = 0;
 const bool cPreferences::m_editor_show_item_images_default = 1;
 const unsigned int cPreferences::m_editor_item_image_size_default = 50;
+// Special
+const unsigned int cPreferences::m_level_prefetch_memory_default = 64;
 
 cPreferences::cPreferences(void)
 {
@@ -162,6 +166,7 @@ void cPreferences::Save(void)
     Add_Property(p_root, "video_screen_bpp", static_cast<int>(m_video_screen_bpp));
     Add_Property(p_root, "video_vsync", m_video_vsync);
     Add_Property(p_root, "video_fps_limit", m_video_fps_limit);
+    Add_Property(p_root, "video_texture_budget", m_video_texture_budget);
     Add_Property(p_root, "video_geometry_quality", pVideo->m_geometry_quality);
     Add_Property(p_root, "video_texture_quality", pVideo->m_texture_quality);
     // Audio
@@ -204,6 +209,7 @@ void cPreferences::Save(void)
     // Special
     Add_Property(p_root, "level_background_images", m_level_background_images);
     Add_Property(p_root, "image_cache_enabled", m_image_cache_enabled);
+    Add_Property(p_root, "level_prefetch_memory", m_level_prefetch_memory);
     // Editor
     Add_Property(p_root, "editor_mouse_auto_hide", m_editor_mouse_auto_hide);
     Add_Property(p_root, "editor_show_item_images", m_editor_show_item_images);
@@ -229,6 +235,7 @@ void cPreferences::Reset_All(void)
     // Special
     m_level_background_images = 1;
     m_image_cache_enabled = 1;
+    m_level_prefetch_memory = m_level_prefetch_memory_default;
 }
 
 void cPreferences::Reset_Game(void)
@@ -248,6 +255,7 @@ void cPreferences::Reset_Video(void)
     m_video_screen_bpp = m_video_screen_bpp_default;
     m_video_vsync = m_video_vsync_default;
     m_video_fps_limit = m_video_fps_limit_default;
+    m_video_texture_budget = m_video_texture_budget_default;
     m_video_fullscreen = m_video_fullscreen_default;
     pVideo->m_geometry_quality = m_geometry_quality_default;
     pVideo->m_texture_quality = m_texture_quality_default;
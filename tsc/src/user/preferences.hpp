@@ -85,6 +85,8 @@ namespace TSC {
         uint8_t m_video_screen_bpp;
         bool m_video_vsync;
         uint16_t m_video_fps_limit;
+        // texture memory budget in megabytes or 0 if unlimited
+        uint16_t m_video_texture_budget;
 
         // Keyboard
         // key definitions
@@ -138,6 +140,8 @@ namespace TSC {
         bool m_level_background_images;
         // image cache enabled
         bool m_image_cache_enabled;
+        // memory in MB for levels loaded in advance (0 = disabled)
+        unsigned int m_level_prefetch_memory;
 
         /* *** *** *** *** *** *** *** */
 
@@ -171,6 +175,7 @@ namespace TSC {
         static const uint8_t m_video_screen_bpp_default;
         static const bool m_video_vsync_default;
         static const uint16_t m_video_fps_limit_default;
+        static const uint16_t m_video_texture_budget_default;
         static const float m_geometry_quality_default;
         static const float m_texture_quality_default;
         // Keyboard
@@ -207,6 +212,8 @@ namespace TSC {
         static const bool m_editor_mouse_auto_hide_default;
         static const bool m_editor_show_item_images_default;
         static const unsigned int m_editor_item_image_size_default;
+        // Special
+        static const unsigned int m_level_prefetch_memory_default;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -28,6 +28,7 @@
 #include "../../core/filesystem/filesystem.hpp"
 #include "../../core/filesystem/resource_manager.hpp"
 #include "../../core/filesystem/package_manager.hpp"
+#include "../../core/property_helper.hpp"
 #include "../../scripting/events/level_load_event.hpp"
 #include "../../scripting/events/level_save_event.hpp"
 #include "../../core/global_basic.hpp"
@@ -46,8 +47,24 @@ cSave_Player_Return_Entry::cSave_Player_Return_Entry(const std::string& level, c
 {
 }
 
+/* *** *** *** *** *** *** *** cSavegame_Index_Entry *** *** *** *** *** *** *** *** *** *** */
+
+cSavegame_Index_Entry::cSavegame_Index_Entry(void)
+{
+    m_file_time = 0;
+    m_file_size = 0;
+    m_valid = 0;
+    m_parse_error = 0;
+    m_version = 0;
+    m_save_time = 0;
+    m_level = 0;
+}
+
 /* *** *** *** *** *** *** *** cSavegame *** *** *** *** *** *** *** *** *** *** */
 
+const fs::path cSavegame::m_index_filename = utf8_to_path("savegames.index");
+const int cSavegame::m_index_version = 2;
+
 cSavegame::cSavegame(void)
 {
     m_savegame_dir = pResource_Manager->Get_User_Savegame_Directory();
@@ -78,6 +95,31 @@ int cSavegame::Load_Game(unsigned int save_slot)
 
     // #### Overworld ####
 
+    /* Worlds which were never loaded are not saved. If one of them
+     * was loaded in this session it may still have the progress of
+     * a previously loaded savegame, so reset it to the defaults.
+    */
+    for (vector<cOverworld*>::iterator itr = pOverworld_Manager->objects.begin(); itr != pOverworld_Manager->objects.end(); ++itr) {
+        cOverworld* overworld = (*itr);
+
+        if (!overworld->Is_Loaded()) {
+            continue;
+        }
+
+        bool saved = 0;
+
+        for (Save_OverworldList::iterator save_itr = savegame->m_overworlds.begin(); save_itr != savegame->m_overworlds.end(); ++save_itr) {
+            if ((*save_itr)->m_name == overworld->m_description->m_name) {
+                saved = 1;
+                break;
+            }
+        }
+
+        if (!saved) {
+            overworld->Reset_Waypoints();
+        }
+    }
+
     // set overworld progress
     if (!savegame->m_overworlds.empty()) {
         for (Save_OverworldList::iterator itr = savegame->m_overworlds.begin(); itr != savegame->m_overworlds.end(); ++itr) {
@@ -87,7 +129,7 @@ int cSavegame::Load_Game(unsigned int save_slot)
             // get overworld
             cOverworld* overworld = pOverworld_Manager->Get_from_Name(save_overworld->m_name);
 
-            if (!overworld) {
+            if (!overworld || !pOverworld_Manager->Load(overworld)) {
                 cerr << "Warning : Savegame " << save_slot << " : Overworld " << save_overworld->m_name << " not found" << endl;
                 continue;
             }
@@ -383,6 +425,11 @@ bool cSavegame::Save_Game(unsigned int save_slot, std::string description)
         // Get Overworld
         cOverworld* overworld = (*itr);
 
+        // never loaded so nothing changed
+        if (!overworld->Is_Loaded()) {
+            continue;
+        }
+
         // create Overworld
         cSave_Overworld* save_overworld = new cSave_Overworld();
         save_overworld->m_name = overworld->m_description->m_name;
@@ -433,6 +480,14 @@ bool cSavegame::Save_Game(unsigned int save_slot, std::string description)
 
     try {
         savegame->Write_To_File(filename);
+
+        // update the index without parsing the savegame again
+        if (save_dir != m_index_dir) {
+            Load_Index(save_dir);
+        }
+
+        Set_Index_Entry(save_slot, filename, savegame);
+        Save_Index();
     }
     catch (xmlpp::exception& e) {
         cerr << "Failed to save savegame '" << filename << "': " << e.what() << endl
@@ -451,60 +506,62 @@ bool cSavegame::Save_Game(unsigned int save_slot, std::string description)
 
 cSave* cSavegame::Load(unsigned int save_slot)
 {
-    fs::path save_dir = pPackage_Manager->Get_User_Savegame_Path();
-    fs::path filename = save_dir / utf8_to_path(int_to_string(save_slot) + ".tscsav");
-
-    cSave* savegame = NULL; //The save game object read from the save state file
-
-    //First try to load the game using the newer format
-    if (File_Exists(filename)) {
-        savegame = cSave::Load_From_File(filename);
-    }
-    else {
-        //If it is not in the newer tscsav format, try the older .smcsav format
-        fs::path filename_smc = save_dir / utf8_to_path(int_to_string(save_slot) + ".smcsav");
-        if (File_Exists(filename_smc)) {
-            savegame = cSave::Load_From_File(filename_smc);
-        }
-        else {
-            //If it is not in the other two formats, try the very old .save format
-            fs::path filename_old = m_savegame_dir / utf8_to_path(int_to_string(save_slot) + ".save");
-            if (File_Exists(filename_old)) {
-                savegame = cSave::Load_From_File(filename_old);
-            }
-            else {
-                //There is not a file in any useful format -- throw an exception
-                std::stringstream ss;
-                ss << "No savegame found at slot " << save_slot << " (filename '" << filename << "' or '" << filename_old << "')!";
-                throw(InvalidSavegameError(save_slot, ss.str()));
-            }
-        }
+    // the newer tscsav format, then the older .smcsav and the very old .save format
+    fs::path filename = Get_Savegame_Filename(save_slot);
+
+    //There is not a file in any useful format -- throw an exception
+    if (filename.empty()) {
+        fs::path save_dir = pPackage_Manager->Get_User_Savegame_Path();
+        fs::path filename_new = save_dir / utf8_to_path(int_to_string(save_slot) + ".tscsav");
+        fs::path filename_old = save_dir / utf8_to_path(int_to_string(save_slot) + ".save");
+
+        std::stringstream ss;
+        ss << "No savegame found at slot " << save_slot << " (filename '" << filename_new << "' or '" << filename_old << "')!";
+        throw(InvalidSavegameError(save_slot, ss.str()));
     }
 
+    cSave* savegame = cSave::Load_From_File(filename); //The save game object read from the save state file
+
     //Now check to make sure each level referenced in the save file exists
-    if (!savegame->m_levels.empty()) {
-        for (Save_LevelList::iterator itr = savegame->m_levels.begin(); itr != savegame->m_levels.end(); ++itr) {
-            cSave_Level* save_level = (*itr);
-            fs::path filename = pLevel_Manager->Get_Path(save_level->m_name);
-            if (filename.empty()) {
-                throw(InvalidLevelError("Empty level filename!"));
-            }
-            if (!File_Exists(filename)) {
-                std::string msg = "Level file not found: " + path_to_utf8(filename);
-                throw (InvalidLevelError(msg));
-            }
-        }
+    std::vector<std::string> levels;
+
+    for (Save_LevelList::iterator itr = savegame->m_levels.begin(); itr != savegame->m_levels.end(); ++itr) {
+        levels.push_back((*itr)->m_name);
+    }
 
+    try {
+        Check_Levels(levels);
+    }
+    catch (...) {
+        delete savegame;
+        throw;
     }
 
     return savegame;
 }
 
+void cSavegame::Check_Levels(const std::vector<std::string>& levels) const
+{
+    for (std::vector<std::string>::const_iterator itr = levels.begin(); itr != levels.end(); ++itr) {
+        fs::path filename = pLevel_Manager->Get_Path(*itr);
+        if (filename.empty()) {
+            throw(InvalidLevelError("Empty level filename!"));
+        }
+        if (!File_Exists(filename)) {
+            std::string msg = "Level file not found: " + path_to_utf8(filename);
+            throw (InvalidLevelError(msg));
+        }
+    }
+}
+
 std::string cSavegame::Get_Description(unsigned int save_slot, bool only_description /* = 0 */)
 {
     std::string str_description;
 
-    if (!Is_Valid(save_slot)) {
+    // the index avoids parsing the savegame
+    const cSavegame_Index_Entry* entry = Get_Index_Entry(save_slot);
+
+    if (!entry) {
         char str[255];
 
         // TRANS: %u is replaced by the number of the save slot, starting with 1.
@@ -512,51 +569,259 @@ std::string cSavegame::Get_Description(unsigned int save_slot, bool only_descrip
         return std::string(str, count);
     }
 
-    // Raises exceptions if fails; caller must take care of them.
-    cSave* savegame = Load(save_slot);
+    // the same exceptions as Load(), caller must take care of them
+    if (!entry->m_valid) {
+        if (entry->m_parse_error) {
+            throw(xmlpp::parse_error(entry->m_error));
+        }
+
+        throw(InvalidSavegameError(save_slot, entry->m_error));
+    }
+
+    // levels may have been added or removed since the index was built
+    Check_Levels(entry->m_levels);
 
     // complete description
     if (!only_description) {
-        str_description = int_to_string(save_slot) + ". " + savegame->m_description;
+        str_description = int_to_string(save_slot) + ". " + entry->m_description;
+
+        if (!entry->m_level) {
+            str_description += " - " + entry->m_location;
+        }
+        else if (!entry->m_location.empty()) {
+            str_description += _(" -  Level ") + entry->m_location;
+        }
+        else {
+            str_description += _(" -  Unknown");
+        }
+
+        str_description += _(" - Date ") + Time_to_String(entry->m_save_time, "%Y-%m-%d  %H:%M:%S");
+    }
+    // only the user description
+    else {
+        str_description = entry->m_description;
+    }
+
+    return str_description;
+}
+
+bool cSavegame::Is_Valid(unsigned int save_slot) const
+{
+    return !Get_Savegame_Filename(save_slot).empty();
+}
+
+const cSavegame_Index_Entry* cSavegame::Get_Index_Entry(unsigned int save_slot)
+{
+    fs::path save_dir = pPackage_Manager->Get_User_Savegame_Path();
+
+    // other package
+    if (save_dir != m_index_dir) {
+        Load_Index(save_dir);
+    }
+
+    // the file Load() would use now
+    fs::path filename = Get_Savegame_Filename(save_slot);
+    std::map<unsigned int, cSavegame_Index_Entry>::iterator itr = m_index.find(save_slot);
+
+    // no savegame
+    if (filename.empty()) {
+        if (itr != m_index.end()) {
+            m_index.erase(itr);
+            Save_Index();
+        }
+
+        return NULL;
+    }
+
+    // up to date if it is the same and unchanged savegame file
+    if (itr != m_index.end() && itr->second.m_filename == filename.filename() &&
+        itr->second.m_file_time == Get_File_Time(filename) && itr->second.m_file_size == Get_File_Size(path_to_utf8(filename))) {
+        return &itr->second;
+    }
+
+    // rebuild from the savegame
+    cSave* savegame = NULL;
+
+    try {
+        savegame = cSave::Load_From_File(filename);
+        Set_Index_Entry(save_slot, filename, savegame);
+    }
+    catch (xmlpp::parse_error& e) {
+        Set_Index_Entry(save_slot, filename, NULL, e.what(), 1);
+    }
+    catch (xmlpp::exception& e) {
+        Set_Index_Entry(save_slot, filename, NULL, e.what());
+    }
+    catch (TSCError& e) {
+        Set_Index_Entry(save_slot, filename, NULL, e.what());
+    }
+
+    Save_Index();
+
+    delete savegame;
+
+    return &m_index[save_slot];
+}
+
+void cSavegame::Set_Index_Entry(unsigned int save_slot, const fs::path& filename, cSave* savegame, const std::string& error /* = "" */, bool parse_error /* = 0 */)
+{
+    cSavegame_Index_Entry entry;
+
+    entry.m_filename = filename.filename();
+    entry.m_file_time = Get_File_Time(filename);
+    entry.m_file_size = Get_File_Size(path_to_utf8(filename));
+    entry.m_error = error;
+    entry.m_parse_error = parse_error;
+
+    if (savegame) {
+        entry.m_valid = 1;
+        entry.m_version = savegame->m_version;
+        entry.m_save_time = savegame->m_save_time;
+        entry.m_description = savegame->m_description;
 
         if (savegame->m_levels.empty()) {
-            str_description += " - " + savegame->m_overworld_active;
+            entry.m_location = savegame->m_overworld_active;
         }
         else {
-            bool found_active = 0;
+            entry.m_level = 1;
 
             for (Save_LevelList::iterator itr = savegame->m_levels.begin(); itr != savegame->m_levels.end(); ++itr) {
                 cSave_Level* level = (*itr);
+                entry.m_levels.push_back(level->m_name);
 
-                // if active level
-                if (!Is_Float_Equal(level->m_level_pos_x, 0.0f) && !Is_Float_Equal(level->m_level_pos_y, 0.0f)) {
-                    str_description += _(" -  Level ") + level->m_name;
-                    found_active = 1;
-                    break;
+                // if first active level
+                if (entry.m_location.empty() && !Is_Float_Equal(level->m_level_pos_x, 0.0f) && !Is_Float_Equal(level->m_level_pos_y, 0.0f)) {
+                    entry.m_location = level->m_name;
                 }
             }
+        }
+    }
 
-            if (!found_active) {
-                str_description += _(" -  Unknown");
-            }
+    m_index[save_slot] = entry;
+}
+
+void cSavegame::Load_Index(const fs::path& save_dir)
+{
+    m_index.clear();
+    m_index_dir = save_dir;
+
+    fs::ifstream file(save_dir / m_index_filename);
+
+    if (!file) {
+        return;
+    }
+
+    std::string line;
+
+    // unknown format is rebuilt
+    if (!std::getline(file, line) || line != int_to_string(m_index_version)) {
+        return;
+    }
+
+    // slot, filename, file time, file size, valid, parse error, error, version, save time, level, location, levels, description
+    while (std::getline(file, line)) {
+        vector<std::string> parts = string_split(line, "\t");
+
+        if (parts.size() != 13) {
+            continue;
+        }
+
+        cSavegame_Index_Entry entry;
+        entry.m_filename = utf8_to_path(parts[1]);
+        entry.m_file_time = string_to_int64(parts[2]);
+        entry.m_file_size = static_cast<size_t>(string_to_int64(parts[3]));
+        entry.m_valid = string_to_bool(parts[4]);
+        entry.m_parse_error = string_to_bool(parts[5]);
+        entry.m_error = parts[6];
+        entry.m_version = string_to_int(parts[7]);
+        entry.m_save_time = static_cast<time_t>(string_to_int64(parts[8]));
+        entry.m_level = string_to_bool(parts[9]);
+        entry.m_location = parts[10];
+
+        // level names can not contain a slash
+        if (!parts[11].empty()) {
+            entry.m_levels = string_split(parts[11], "/");
         }
 
-        str_description += _(" - Date ") + Time_to_String(savegame->m_save_time, "%Y-%m-%d  %H:%M:%S");
+        entry.m_description = parts[12];
+
+        m_index[string_to_int(parts[0])] = entry;
     }
-    // only the user description
-    else {
-        str_description = savegame->m_description;
+}
+
+void cSavegame::Save_Index(void) const
+{
+    if (m_index_dir.empty() || !Dir_Exists(m_index_dir)) {
+        return;
     }
 
-    delete savegame;
-    return str_description;
+    // write to a temporary file first to never leave a partial index
+    fs::path filename = m_index_dir / m_index_filename;
+    fs::path temp_filename = filename;
+    temp_filename.replace_extension(".tmp");
+
+    {
+        fs::ofstream file(temp_filename, ios::out | ios::trunc);
+
+        if (!file) {
+            cerr << "Warning : Could not write savegame index " << path_to_utf8(temp_filename) << endl;
+            return;
+        }
+
+        file << m_index_version << "\n";
+
+        for (std::map<unsigned int, cSavegame_Index_Entry>::const_iterator itr = m_index.begin(); itr != m_index.end(); ++itr) {
+            const cSavegame_Index_Entry& entry = itr->second;
+
+            // descriptions and errors are single line texts
+            std::string description = entry.m_description;
+            std::replace(description.begin(), description.end(), '\t', ' ');
+            std::replace(description.begin(), description.end(), '\n', ' ');
+            std::string error = entry.m_error;
+            std::replace(error.begin(), error.end(), '\t', ' ');
+            std::replace(error.begin(), error.end(), '\n', ' ');
+
+            std::string levels;
+
+            for (vector<std::string>::const_iterator level_itr = entry.m_levels.begin(); level_itr != entry.m_levels.end(); ++level_itr) {
+                if (!levels.empty()) {
+                    levels += "/";
+                }
+
+                levels += *level_itr;
+            }
+
+            file << itr->first << "\t" << path_to_utf8(entry.m_filename) << "\t";
+            file << int64_to_string(entry.m_file_time) << "\t" << int64_to_string(entry.m_file_size) << "\t";
+            file << (entry.m_valid ? "1" : "0") << "\t" << (entry.m_parse_error ? "1" : "0") << "\t" << error << "\t";
+            file << entry.m_version << "\t" << int64_to_string(entry.m_save_time) << "\t";
+            file << (entry.m_level ? "1" : "0") << "\t" << entry.m_location << "\t" << levels << "\t" << description << "\n";
+        }
+    }
+
+    boost::system::error_code ec;
+    fs::rename(temp_filename, filename, ec);
+
+    if (ec) {
+        cerr << "Warning : Could not write savegame index " << path_to_utf8(filename) << " : " << ec.message() << endl;
+    }
 }
 
-bool cSavegame::Is_Valid(unsigned int save_slot) const
+fs::path cSavegame::Get_Savegame_Filename(unsigned int save_slot) const
 {
     fs::path save_dir = pPackage_Manager->Get_User_Savegame_Path();
-    return (File_Exists(save_dir / utf8_to_path(int_to_string(save_slot) + ".tscsav")) || File_Exists(save_dir / utf8_to_path(int_to_string(save_slot) + ".smcsav")) ||
-            File_Exists(save_dir / utf8_to_path(int_to_string(save_slot) + ".save")));
+    const char* extensions[] = {".tscsav", ".smcsav", ".save"};
+
+    // in the order Load() uses them
+    for (unsigned int i = 0; i < 3; i++) {
+        fs::path filename = save_dir / utf8_to_path(int_to_string(save_slot) + extensions[i]);
+
+        if (File_Exists(filename)) {
+            return filename;
+        }
+    }
+
+    return fs::path();
 }
 
 cSavegame* pSavegame = NULL;
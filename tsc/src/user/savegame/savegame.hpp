@@ -29,6 +29,38 @@ namespace TSC {
 #define SAVEGAME_VERSION 12
 #define SAVEGAME_VERSION_UNSUPPORTED 5
 
+    /* *** *** *** *** *** *** *** cSavegame_Index_Entry *** *** *** *** *** *** *** *** *** *** */
+
+    // Summary of a savegame as stored in the savegame index
+    class cSavegame_Index_Entry {
+    public:
+        cSavegame_Index_Entry(void);
+
+        // savegame filename in the savegame directory
+        boost::filesystem::path m_filename;
+        // modification time and size of the savegame file
+        uint64_t m_file_time;
+        size_t m_file_size;
+        // the savegame could be loaded
+        bool m_valid;
+        // loading error message if not valid
+        std::string m_error;
+        // the loading error was an XML parse error
+        bool m_parse_error;
+        // savegame version
+        int m_version;
+        // time the game was saved
+        time_t m_save_time;
+        // user description
+        std::string m_description;
+        // active level or overworld name (empty if the active level is unknown)
+        std::string m_location;
+        // the location is a level
+        bool m_level;
+        // names of all levels in the savegame
+        std::vector<std::string> m_levels;
+    };
+
     /* *** *** *** *** *** *** *** cSavegame *** *** *** *** *** *** *** *** *** *** */
 
 // TODO: Maybe this class should be removed entirely and merged with cSave?
@@ -77,6 +109,37 @@ namespace TSC {
 
         // savegame directory
         boost::filesystem::path m_savegame_dir;
+
+        // index filename in the savegame directory
+        static const boost::filesystem::path m_index_filename;
+        // index format version
+        static const int m_index_version;
+
+    private:
+        /* Return the index entry of the slot or NULL if no savegame exists
+         * The entry is rebuilt from the savegame file if it is missing or
+         * another file or a changed file is used for the slot now.
+        */
+        const cSavegame_Index_Entry* Get_Index_Entry(unsigned int save_slot);
+        /* Set the index entry of the slot from the given savegame
+         * savegame : NULL if it could not be loaded
+         * error : the loading error message
+         * parse_error : the loading error was an XML parse error
+        */
+        void Set_Index_Entry(unsigned int save_slot, const boost::filesystem::path& filename, cSave* savegame, const std::string& error = "", bool parse_error = 0);
+        // Throw InvalidLevelError if a level file of the given level names does not exist
+        void Check_Levels(const std::vector<std::string>& levels) const;
+        // Load the index of the given savegame directory
+        void Load_Index(const boost::filesystem::path& save_dir);
+        // Write the index
+        void Save_Index(void) const;
+        // Return the savegame file of the slot or an empty path if none exists
+        boost::filesystem::path Get_Savegame_Filename(unsigned int save_slot) const;
+
+        // index entries by slot
+        std::map<unsigned int, cSavegame_Index_Entry> m_index;
+        // directory of the loaded index
+        boost::filesystem::path m_index_dir;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
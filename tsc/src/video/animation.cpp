@@ -16,6 +16,7 @@
 
 #include "../video/animation.hpp"
 #include "../core/framerate.hpp"
+#include "../core/job_pool.hpp"
 #include "../core/game_core.hpp"
 #include "../video/gl_surface.hpp"
 #include "../video/renderer.hpp"
@@ -572,6 +573,8 @@ void cParticle_Emitter::Init(void)
     m_sprite_array = ARRAY_ACTIVE;
     m_type = TYPE_PARTICLE_EMITTER;
     m_name = "Particle Emitter";
+    // keep the particles moving far away
+    m_sleep_policy = SLEEP_REDUCED;
 
     m_emitter_based_on_camera_pos = 0;
     m_particle_based_on_emitter_pos = 0.0f;
@@ -906,16 +909,24 @@ void cParticle_Emitter::Update(void)
     Update_Particles();
 }
 
+void cParticle_Emitter::Update_Particle_Range(unsigned int start, unsigned int end)
+{
+    // particles only change themselves
+    for (unsigned int i = start; i < end; i++) {
+        m_objects[i]->Update();
+    }
+}
+
 void cParticle_Emitter::Update_Particles(void)
 {
     // update objects
+    pJob_Pool->Run(m_objects.size(), boost::bind(&cParticle_Emitter::Update_Particle_Range, this, _1, _2), 128);
+
+    // remove finished objects in order
     for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end();) {
         // get object pointer
         cParticle* obj = (*itr);
 
-        // update
-        obj->Update();
-
         // if finished
         if (!obj->m_active) {
             itr = m_objects.erase(itr);
@@ -1183,6 +1194,14 @@ void cParticle_Emitter::Set_Spawned(bool enable /* = 0 */)
 void cParticle_Emitter::Set_Based_On_Camera_Pos(bool enable)
 {
     m_emitter_based_on_camera_pos = enable;
+
+    // the position is not where the particles are
+    if (m_emitter_based_on_camera_pos) {
+        m_sleep_policy = SLEEP_NEVER;
+    }
+    else {
+        m_sleep_policy = SLEEP_REDUCED;
+    }
 }
 
 void cParticle_Emitter::Set_Particle_Based_On_Emitter_Pos(float val)
@@ -194,6 +194,8 @@ namespace TSC {
          * does not update emitter living time
         */
         void Update_Particles(void);
+        // update the particles of the given range, run on the job pool threads
+        void Update_Particle_Range(unsigned int start, unsigned int end);
         // update position and clipping
         void Update_Position(void);
         // Draw everything
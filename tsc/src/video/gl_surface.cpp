@@ -57,6 +57,8 @@ cGL_Surface::cGL_Surface(void)
     m_auto_del_img = 1;
     m_managed = 0;
     m_obsolete = 0;
+    m_last_use_frame = 0;
+    m_evicted = 0;
 
     // default massive type is passive
     m_massive_type = MASS_PASSIVE;
@@ -137,7 +139,7 @@ void cGL_Surface::Blit(float x, float y, float z, cSurface_Request* request /* =
 void cGL_Surface::Blit_Data(cSurface_Request* request) const
 {
     // texture id
-    request->m_texture_id = m_image;
+    request->m_texture_id = Get_Texture();
 
     // position
     request->m_pos_x += m_int_x;
@@ -153,8 +155,61 @@ void cGL_Surface::Blit_Data(cSurface_Request* request) const
     request->m_rot_z += m_base_rot_z;
 }
 
+GLuint cGL_Surface::Get_Texture(void) const
+{
+    if (m_managed) {
+        m_last_use_frame = pImage_Manager->m_frame;
+
+        // the texture is not part of the surface state so it can be reloaded here
+        if (m_evicted) {
+            const_cast<cGL_Surface*>(this)->Reload_Texture();
+        }
+    }
+
+    return m_image;
+}
+
+uint64_t cGL_Surface::Get_Texture_Memory(void) const
+{
+    if (!m_image) {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(m_tex_w) * m_tex_h * 4;
+}
+
+bool cGL_Surface::Reload_Texture(void)
+{
+    // don't try again every frame if it fails
+    m_evicted = 0;
+
+    if (m_path.empty()) {
+        return 0;
+    }
+
+    cGL_Surface* surface_copy = pVideo->Load_GL_Surface(m_path);
+
+    if (!surface_copy) {
+        cerr << "Warning: cGL_Surface :: Reload_Texture " << m_path.c_str() << " loading failed" << endl;
+        return 0;
+    }
+
+    // get image
+    m_image = surface_copy->m_image;
+    m_tex_w = surface_copy->m_tex_w;
+    m_tex_h = surface_copy->m_tex_h;
+    // keep hardware texture
+    surface_copy->m_auto_del_img = 0;
+    // delete copy
+    delete surface_copy;
+
+    return 1;
+}
+
 void cGL_Surface::Save(const std::string& filename)
 {
+    Get_Texture();
+
     if (!m_image) {
         cerr << "Couldn't save cGL_Surface : No Image Texture ID set" << endl;
         return;
@@ -272,21 +327,7 @@ void cGL_Surface::Load_Software_Texture(cSaved_Texture* soft_tex)
     }
     // load from file
     else {
-        cGL_Surface* surface_copy = pVideo->Load_GL_Surface(m_path);
-
-        if (!surface_copy) {
-            cerr << "Warning: cGL_Surface :: Load_Software_Texture " << m_path.c_str() << " loading failed" << endl;
-            return;
-        }
-
-        // get image
-        m_image = surface_copy->m_image;
-        m_tex_w = surface_copy->m_tex_w;
-        m_tex_h = surface_copy->m_tex_h;
-        // keep hardware texture
-        surface_copy->m_auto_del_img = 0;
-        // delete copy
-        delete surface_copy;
+        Reload_Texture();
     }
 }
 
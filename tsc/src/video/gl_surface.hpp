@@ -36,6 +36,18 @@ namespace TSC {
         // Blit only the surface data on the given request
         void Blit_Data(cSurface_Request* request) const;
 
+        /* Return the GL texture number for drawing
+         * Marks a managed surface as used in the current frame and loads
+         * the texture again if it was evicted by the image manager.
+        */
+        GLuint Get_Texture(void) const;
+        // Return the size of the texture in video memory in bytes
+        uint64_t Get_Texture_Memory(void) const;
+        /* Load the texture again from m_path
+         * Returns false if it could not be loaded.
+        */
+        bool Reload_Texture(void);
+
         // Copy cGL_Surface and return it
         cGL_Surface* Copy(void) const;
 
@@ -102,6 +114,10 @@ namespace TSC {
         bool m_managed;
         // if the image is tagged as obsolete
         bool m_obsolete;
+        // image manager frame the texture was last drawn in
+        mutable uint32_t m_last_use_frame;
+        // if the texture was deleted to stay in the texture memory budget
+        bool m_evicted;
 
         // editor tags
         std::string m_editor_tags;
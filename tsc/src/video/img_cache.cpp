@@ -0,0 +1,373 @@
+/***************************************************************************
+ * img_cache.cpp - Image cache builder
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/img_cache.hpp"
+#include "../video/video.hpp"
+#include "../video/img_settings.hpp"
+#include "../video/texture_cache.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/filesystem/relative.hpp"
+#include "../core/filesystem/resource_manager.hpp"
+#include "../core/global_basic.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cImage_Cache_Entry *** *** *** *** *** *** *** *** *** *** */
+
+cImage_Cache_Entry::cImage_Cache_Entry(void)
+{
+    m_source_time = 0;
+    m_png_time = 0;
+    m_cached = 0;
+    m_dirty = 1;
+}
+
+/* *** *** *** *** *** *** *** cImage_Cache_Builder *** *** *** *** *** *** *** *** *** *** */
+
+const fs::path cImage_Cache_Builder::m_manifest_filename = utf8_to_path("cache.manifest");
+const int cImage_Cache_Builder::m_manifest_version = 2;
+
+cImage_Cache_Builder::cImage_Cache_Builder(const fs::path& cache_dir, const fs::path& pixmaps_dir)
+{
+    m_cache_dir = cache_dir;
+    m_pixmaps_dir = pixmaps_dir;
+
+    m_next_build = 0;
+    m_built_count = 0;
+    m_downscale_time = 0;
+    m_build_time = 0;
+}
+
+cImage_Cache_Builder::~cImage_Cache_Builder(void)
+{
+    m_threads.join_all();
+}
+
+size_t cImage_Cache_Builder::Prepare(bool force /* = 0 */)
+{
+    std::map<std::string, cImage_Cache_Entry> old_entries;
+
+    if (!force && !Load_Manifest(old_entries)) {
+        debug_print("Image cache manifest missing or outdated, rebuilding %s\n", path_to_utf8(m_cache_dir).c_str());
+    }
+
+    // get all files
+    vector<fs::path> image_files = Get_Directory_Files(m_pixmaps_dir, ".settings", true);
+
+    for (vector<fs::path>::iterator itr = image_files.begin(); itr != image_files.end(); ++itr) {
+        const fs::path& filename = (*itr);
+        const std::string key = Get_Key(filename);
+        fs::path cache_filename = m_cache_dir / utf8_to_path(key);
+
+        // directories are created here as the worker threads would race for them
+        if (fs::is_directory(filename)) {
+            if (!fs::is_directory(cache_filename)) {
+                fs::create_directories(cache_filename);
+            }
+
+            continue;
+        }
+
+        cImage_Cache_Entry entry;
+        entry.m_source = filename;
+        entry.m_cache_filename = cache_filename;
+        entry.m_cache_filename.replace_extension(".png");
+        // the base settings files also change the downscaled size
+        entry.m_source_time = cTexture_Cache_File::Get_Settings_Time(filename);
+
+        std::map<std::string, cImage_Cache_Entry>::iterator old_itr = old_entries.find(key);
+
+        // unchanged since the last build
+        if (old_itr != old_entries.end()) {
+            const cImage_Cache_Entry& old_entry = old_itr->second;
+
+            if (old_entry.m_source_time == entry.m_source_time && old_entry.m_png_time == Get_File_Time(old_entry.m_real_png_path) &&
+                (!old_entry.m_cached || File_Exists(entry.m_cache_filename))) {
+                entry.m_real_png_path = old_entry.m_real_png_path;
+                entry.m_png_time = old_entry.m_png_time;
+                entry.m_cached = old_entry.m_cached;
+                entry.m_dirty = 0;
+            }
+
+            old_entries.erase(old_itr);
+        }
+
+        if (entry.m_dirty) {
+            m_build_list.push_back(m_entries.size());
+        }
+
+        m_entries.push_back(entry);
+    }
+
+    // remove cache images of deleted source images
+    for (std::map<std::string, cImage_Cache_Entry>::iterator itr = old_entries.begin(); itr != old_entries.end(); ++itr) {
+        if (itr->second.m_cached) {
+            boost::system::error_code ec;
+            fs::remove(itr->second.m_cache_filename, ec);
+        }
+    }
+
+    return m_build_list.size();
+}
+
+void cImage_Cache_Builder::Start(unsigned int thread_count /* = 0 */)
+{
+    if (!thread_count) {
+        thread_count = boost::thread::hardware_concurrency();
+    }
+
+    // not more threads than images
+    if (thread_count > m_build_list.size()) {
+        thread_count = m_build_list.size();
+    }
+
+    for (unsigned int i = 0; i < thread_count; i++) {
+        m_threads.add_thread(new boost::thread(&cImage_Cache_Builder::Build_Thread, this));
+    }
+}
+
+bool cImage_Cache_Builder::Is_Finished(void)
+{
+    boost::mutex::scoped_lock lock(m_mutex);
+
+    return m_built_count >= m_build_list.size();
+}
+
+void cImage_Cache_Builder::Finish(void)
+{
+    // also builds everything if Start() was not called
+    Build_Thread();
+    m_threads.join_all();
+
+    Save_Manifest();
+
+    if (!m_build_list.empty()) {
+        debug_print("Image cache: built %u images in %u ms of thread time, downscaling took %u ms\n", static_cast<unsigned int>(m_build_list.size()),
+                    static_cast<unsigned int>(m_build_time / 1000), static_cast<unsigned int>(m_downscale_time / 1000));
+    }
+}
+
+float cImage_Cache_Builder::Get_Progress(void)
+{
+    boost::mutex::scoped_lock lock(m_mutex);
+
+    if (m_build_list.empty()) {
+        return 1.0f;
+    }
+
+    return static_cast<float>(m_built_count) / static_cast<float>(m_build_list.size());
+}
+
+void cImage_Cache_Builder::Build_Thread(void)
+{
+    while (1) {
+        size_t index;
+
+        {
+            boost::mutex::scoped_lock lock(m_mutex);
+
+            if (m_next_build >= m_build_list.size()) {
+                return;
+            }
+
+            index = m_build_list[m_next_build];
+            m_next_build++;
+        }
+
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+        // each entry is only used by one thread
+        uint64_t downscale_time = Build_Entry(m_entries[index]);
+
+        std::chrono::microseconds build_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time);
+
+        boost::mutex::scoped_lock lock(m_mutex);
+        m_built_count++;
+        m_downscale_time += downscale_time;
+        m_build_time += build_time.count();
+    }
+}
+
+uint64_t cImage_Cache_Builder::Build_Entry(cImage_Cache_Entry& entry) const
+{
+    entry.m_dirty = 0;
+    entry.m_cached = 0;
+
+    // the old cache image would be loaded instead of the changed source
+    boost::system::error_code ec;
+    fs::remove(entry.m_cache_filename, ec);
+
+    // Don't use .settings file type directly for image loading
+    fs::path filename = entry.m_source;
+    filename.replace_extension(".png");
+
+    // load software image
+    cVideo::cSoftware_Image software_image = pVideo->Load_Image(filename);
+    sf::Image* p_sf_image = software_image.m_sf_image;
+    cImage_Settings_Data* settings = software_image.m_settings;
+
+    // remember the image file to notice changes of images given as base
+    entry.m_real_png_path = software_image.m_real_png_path.empty() ? filename : software_image.m_real_png_path;
+    entry.m_png_time = Get_File_Time(entry.m_real_png_path);
+
+    // failed to load image
+    if (!p_sf_image) {
+        return 0;
+    }
+
+    /* don't cache if no image settings or images without the width and height set
+     * as there is currently no support to get the old and real image size
+     * and thus the scaled down (cached) image size is used which is wrong
+    */
+    if (!settings || !settings->m_width || !settings->m_height) {
+        if (settings) {
+            debug_print("Info : %s has no image settings image size set and will not get cached\n", path_to_utf8(entry.m_cache_filename).c_str());
+            delete settings;
+        }
+        else {
+            debug_print("Info : %s has no image settings and will not get cached\n", path_to_utf8(entry.m_cache_filename).c_str());
+        }
+        delete p_sf_image;
+        return 0;
+    }
+
+    // create final image
+    p_sf_image = pVideo->Convert_To_Final_Software_Image(p_sf_image);
+
+    // get final size for this resolution
+    cSize_Int size = settings->Get_Surface_Size(p_sf_image);
+    delete settings;
+    int new_width = size.m_width;
+    int new_height = size.m_height;
+
+    // apply maximum texture size
+    pVideo->Apply_Max_Texture_Size(new_width, new_height);
+
+    // does not need to be downsampled
+    if (new_width >= static_cast<int>(p_sf_image->getSize().x) && new_height >= static_cast<int>(p_sf_image->getSize().y)) {
+        delete p_sf_image;
+        return 0;
+    }
+
+    // calculate block reduction
+    int reduce_block_x = p_sf_image->getSize().x / new_width;
+    int reduce_block_y = p_sf_image->getSize().y / new_height;
+
+    // create downsampled image, SFML always gives 4 bytes per pixel (RGBA)
+    unsigned int image_bpp = 4;
+    unsigned char* image_downsampled = new unsigned char[new_width * new_height * image_bpp];
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    bool downsampled = pVideo->Downscale_Image(static_cast<const unsigned char*>(p_sf_image->getPixelsPtr()), p_sf_image->getSize().x, p_sf_image->getSize().y, image_bpp, image_downsampled, reduce_block_x, reduce_block_y);
+
+    std::chrono::microseconds downscale_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time);
+
+    delete p_sf_image;
+
+    // save as png
+    if (downsampled) {
+        pVideo->Save_Surface(entry.m_cache_filename, image_downsampled, new_width, new_height, image_bpp);
+        entry.m_cached = File_Exists(entry.m_cache_filename);
+    }
+
+    delete[] image_downsampled;
+
+    return downscale_time.count();
+}
+
+bool cImage_Cache_Builder::Load_Manifest(std::map<std::string, cImage_Cache_Entry>& entries) const
+{
+    fs::ifstream file(m_cache_dir / m_manifest_filename);
+
+    if (!file) {
+        return 0;
+    }
+
+    std::string line;
+
+    // the header must match or the cache images were created differently
+    if (!std::getline(file, line) || line != int_to_string(m_manifest_version) + "\t" + int_to_string(pVideo->m_max_texture_size)) {
+        return 0;
+    }
+
+    // key, settings time, real image path, image time, cached
+    while (std::getline(file, line)) {
+        vector<std::string> parts = string_split(line, "\t");
+
+        if (parts.size() != 5) {
+            continue;
+        }
+
+        cImage_Cache_Entry entry;
+        entry.m_source_time = string_to_int64(parts[1]);
+        entry.m_real_png_path = fs::absolute(utf8_to_path(parts[2]), pResource_Manager->Get_Game_Data_Directory());
+        entry.m_png_time = string_to_int64(parts[3]);
+        entry.m_cached = string_to_bool(parts[4]);
+        entry.m_cache_filename = m_cache_dir / utf8_to_path(parts[0]);
+        entry.m_cache_filename.replace_extension(".png");
+        entry.m_dirty = 0;
+
+        entries[parts[0]] = entry;
+    }
+
+    return 1;
+}
+
+void cImage_Cache_Builder::Save_Manifest(void) const
+{
+    // write to a temporary file first to never leave a partial manifest
+    fs::path filename = m_cache_dir / m_manifest_filename;
+    fs::path temp_filename = filename;
+    temp_filename.replace_extension(".tmp");
+
+    {
+        fs::ofstream file(temp_filename, ios::out | ios::trunc);
+
+        if (!file) {
+            cerr << "Warning : Could not write image cache manifest " << path_to_utf8(temp_filename) << endl;
+            return;
+        }
+
+        file << m_manifest_version << "\t" << pVideo->m_max_texture_size << "\n";
+
+        for (vector<cImage_Cache_Entry>::const_iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+            const cImage_Cache_Entry& entry = (*itr);
+
+            file << Get_Key(entry.m_source) << "\t" << int64_to_string(entry.m_source_time) << "\t";
+            file << Get_Key(entry.m_real_png_path) << "\t" << int64_to_string(entry.m_png_time) << "\t";
+            file << (entry.m_cached ? "1" : "0") << "\n";
+        }
+    }
+
+    boost::system::error_code ec;
+    fs::rename(temp_filename, filename, ec);
+
+    if (ec) {
+        cerr << "Warning : Could not write image cache manifest " << path_to_utf8(filename) << " : " << ec.message() << endl;
+    }
+}
+
+std::string cImage_Cache_Builder::Get_Key(const fs::path& path) const
+{
+    return path_to_utf8(fs_relative(pResource_Manager->Get_Game_Data_Directory(), path));
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,130 @@
+/***************************************************************************
+ * img_cache.hpp - Image cache builder
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_IMG_CACHE_HPP
+#define TSC_IMG_CACHE_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cImage_Cache_Entry *** *** *** *** *** *** *** *** *** *** */
+
+    // One cached image as listed in the image cache manifest
+    class cImage_Cache_Entry {
+    public:
+        cImage_Cache_Entry(void);
+
+        // source image settings file
+        boost::filesystem::path m_source;
+        // the image file actually loaded for the settings file
+        boost::filesystem::path m_real_png_path;
+        // cache image file
+        boost::filesystem::path m_cache_filename;
+        /* combined modification time of the settings file and its
+         * base settings files and modification time of the image file
+        */
+        uint64_t m_source_time;
+        uint64_t m_png_time;
+        // a cache image was written
+        bool m_cached;
+        // needs to be (re)built
+        bool m_dirty;
+    };
+
+    /* *** *** *** *** *** *** *** cImage_Cache_Builder *** *** *** *** *** *** *** *** *** *** */
+
+    /* Builds the downscaled images for one resolution cache directory
+     *
+     * Every source image is listed with its file modification times in
+     * a manifest file in the cache directory. Only images which changed
+     * since the last run are rebuilt. The images are loaded, downscaled
+     * and saved by several worker threads while the caller keeps
+     * drawing the loading screen.
+    */
+    class cImage_Cache_Builder {
+    public:
+        /* cache_dir : the resolution cache directory
+         * pixmaps_dir : the source pixmaps directory
+        */
+        cImage_Cache_Builder(const boost::filesystem::path& cache_dir, const boost::filesystem::path& pixmaps_dir);
+        // Waits for the worker threads
+        ~cImage_Cache_Builder(void);
+
+        /* Compare the source images with the manifest
+         * Creates the cache directories and removes cache images of deleted sources.
+         * force : rebuild every image
+         * Returns the number of images to build
+        */
+        size_t Prepare(bool force = 0);
+        /* Start building in the background
+         * thread_count : number of worker threads (0 = number of CPU cores)
+        */
+        void Start(unsigned int thread_count = 0);
+        // Return true if all images are built
+        bool Is_Finished(void);
+        // Wait for the worker threads and save the manifest
+        void Finish(void);
+        // Return the build progress (range 0.0-1.0)
+        float Get_Progress(void);
+
+        // manifest filename in the cache directory
+        static const boost::filesystem::path m_manifest_filename;
+        // manifest format version, increase if the cache image creation changes
+        static const int m_manifest_version;
+
+    private:
+        // Worker thread function
+        void Build_Thread(void);
+        /* Load, downscale and save the given image
+         * Returns the time spent in cVideo::Downscale_Image() in microseconds
+        */
+        uint64_t Build_Entry(cImage_Cache_Entry& entry) const;
+
+        // Load the manifest entries into the given map. Returns false if not usable.
+        bool Load_Manifest(std::map<std::string, cImage_Cache_Entry>& entries) const;
+        // Write the manifest
+        void Save_Manifest(void) const;
+        // Return the manifest key for the given path
+        std::string Get_Key(const boost::filesystem::path& path) const;
+
+        // cache directory
+        boost::filesystem::path m_cache_dir;
+        // source pixmaps directory
+        boost::filesystem::path m_pixmaps_dir;
+
+        // all source images
+        std::vector<cImage_Cache_Entry> m_entries;
+        // indexes of the images to build
+        std::vector<size_t> m_build_list;
+
+        // worker threads
+        boost::thread_group m_threads;
+        // guards the build counters
+        boost::mutex m_mutex;
+        // next m_build_list index to build
+        size_t m_next_build;
+        // number of built images
+        size_t m_built_count;
+        // time spent downscaling and building in microseconds
+        uint64_t m_downscale_time;
+        uint64_t m_build_time;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -16,8 +16,10 @@
 
 #include "../video/img_manager.hpp"
 #include "../video/renderer.hpp"
+#include "../video/img_set.hpp"
 #include "../video/loading_screen.hpp"
 #include "../core/i18n.hpp"
+#include "../user/preferences.hpp"
 #include "../core/global_basic.hpp"
 
 using namespace std;
@@ -52,10 +54,15 @@ cSaved_Texture::~cSaved_Texture(void)
 
 /* *** *** *** *** *** *** cImage_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
+const uint32_t cImage_Manager::m_budget_check_frames = 60;
+// keeps textures of multi frame render requests
+const uint32_t cImage_Manager::m_evict_idle_frames = 300;
+
 cImage_Manager::cImage_Manager(void)
     : cObject_Manager<cGL_Surface>()
 {
     m_high_texture_id = 0;
+    m_frame = 0;
 }
 
 cImage_Manager::~cImage_Manager(void)
@@ -136,7 +143,8 @@ void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* =
         }
 
         // get software texture and save it to software memory
-        m_saved_textures.push_back(obj->Get_Software_Texture(from_file));
+        // textures from a file are loaded again instead of reading them back
+        m_saved_textures.push_back(obj->Get_Software_Texture(from_file || !obj->m_path.empty()));
         // delete hardware texture
         if (glIsTexture(obj->m_image)) {
             glDeleteTextures(1, &obj->m_image);
@@ -225,7 +233,173 @@ void cImage_Manager::Delete_All(void)
 {
     // stops cGL_Surface destructor from checking if GL texture id still in use
     Delete_Image_Textures();
+    // cached image set definitions point to the deleted surfaces
+    cImageSet::Clear_Definitions();
     cObject_Manager<cGL_Surface>::Delete_All();
+    Delete_Preloaded_Images();
+}
+
+void cImage_Manager::Update(void)
+{
+    m_frame++;
+
+    if (m_frame % m_budget_check_frames) {
+        return;
+    }
+
+    const uint64_t budget = static_cast<uint64_t>(pPreferences->m_video_texture_budget) * 1024 * 1024;
+
+    // unlimited
+    if (!budget) {
+        return;
+    }
+
+    uint64_t memory = Get_Texture_Memory();
+
+    if (memory <= budget) {
+        return;
+    }
+
+    // surfaces using each texture
+    std::map<GLuint, unsigned int> texture_users;
+
+    for (GL_Surface_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        if ((*itr)->m_image) {
+            texture_users[(*itr)->m_image]++;
+        }
+    }
+
+    GL_Surface_List candidates;
+
+    for (GL_Surface_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cGL_Surface* obj = (*itr);
+
+        if (!obj->m_image || !obj->m_auto_del_img || obj->m_path.empty() || texture_users[obj->m_image] > 1) {
+            continue;
+        }
+
+        // recently drawn
+        if (m_frame - obj->m_last_use_frame < m_evict_idle_frames) {
+            continue;
+        }
+
+        candidates.push_back(obj);
+    }
+
+    std::sort(candidates.begin(), candidates.end(), last_use_sort());
+
+    for (GL_Surface_List::iterator itr = candidates.begin(); itr != candidates.end() && memory > budget; ++itr) {
+        cGL_Surface* obj = (*itr);
+        const uint64_t texture_memory = obj->Get_Texture_Memory();
+
+        if (Evict_Texture(obj)) {
+            memory -= texture_memory;
+        }
+    }
+}
+
+bool cImage_Manager::Evict_Texture(cGL_Surface* obj)
+{
+    if (!obj->m_image || obj->m_path.empty() || !obj->m_auto_del_img) {
+        return 0;
+    }
+
+    if (glIsTexture(obj->m_image)) {
+        glDeleteTextures(1, &obj->m_image);
+    }
+
+    obj->m_image = 0;
+    obj->m_evicted = 1;
+
+    return 1;
+}
+
+uint64_t cImage_Manager::Get_Texture_Memory(void) const
+{
+    uint64_t memory = 0;
+
+    for (GL_Surface_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        memory += (*itr)->Get_Texture_Memory();
+    }
+
+    return memory;
+}
+
+bool cImage_Manager::Add_Preloaded_Image(const fs::path& path, cVideo::cSoftware_Image software_image)
+{
+    if (!software_image.m_sf_image) {
+        return 0;
+    }
+
+    boost::mutex::scoped_lock lock(m_preloaded_mutex);
+
+    // already available
+    if (m_preloaded_images.count(path)) {
+        delete software_image.m_sf_image;
+        delete software_image.m_settings;
+        return 0;
+    }
+
+    m_preloaded_images[path] = software_image;
+    return 1;
+}
+
+cVideo::cSoftware_Image cImage_Manager::Take_Preloaded_Image(const fs::path& path)
+{
+    boost::mutex::scoped_lock lock(m_preloaded_mutex);
+
+    Preloaded_Image_Map::iterator itr = m_preloaded_images.find(path);
+
+    // not available
+    if (itr == m_preloaded_images.end()) {
+        return cVideo::cSoftware_Image();
+    }
+
+    cVideo::cSoftware_Image software_image = itr->second;
+    m_preloaded_images.erase(itr);
+
+    return software_image;
+}
+
+bool cImage_Manager::Has_Preloaded_Image(const fs::path& path, const sf::Image* image /* = NULL */)
+{
+    boost::mutex::scoped_lock lock(m_preloaded_mutex);
+
+    Preloaded_Image_Map::const_iterator itr = m_preloaded_images.find(path);
+
+    if (itr == m_preloaded_images.end()) {
+        return 0;
+    }
+
+    return !image || itr->second.m_sf_image == image;
+}
+
+void cImage_Manager::Delete_Preloaded_Image(const fs::path& path, const sf::Image* image)
+{
+    boost::mutex::scoped_lock lock(m_preloaded_mutex);
+
+    Preloaded_Image_Map::iterator itr = m_preloaded_images.find(path);
+
+    // taken or replaced by another one
+    if (itr == m_preloaded_images.end() || itr->second.m_sf_image != image) {
+        return;
+    }
+
+    delete itr->second.m_sf_image;
+    delete itr->second.m_settings;
+    m_preloaded_images.erase(itr);
+}
+
+void cImage_Manager::Delete_Preloaded_Images(void)
+{
+    boost::mutex::scoped_lock lock(m_preloaded_mutex);
+
+    for (Preloaded_Image_Map::iterator itr = m_preloaded_images.begin(); itr != m_preloaded_images.end(); ++itr) {
+        delete itr->second.m_sf_image;
+        delete itr->second.m_settings;
+    }
+
+    m_preloaded_images.clear();
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
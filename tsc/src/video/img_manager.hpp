@@ -86,6 +86,8 @@ namespace TSC {
         }
 
         /* Save hardware textures in software memory
+         * Textures created from a file are always loaded again from the file
+         * which is fast with the texture cache.
          * from_file: if set don't store in software memory but load again from file
          * draw_gui : if set use the loading screen gui for drawing
         */
@@ -106,12 +108,67 @@ namespace TSC {
         // Delete all Surfaces
         virtual void Delete_All(void);
 
+        /* Advance the frame counter and delete the least recently drawn
+         * textures if the texture memory is above the budget preference
+         * Must be called once per frame while the OpenGL context is current.
+        */
+        void Update(void);
+        /* Delete the texture of the given surface until it is drawn again
+         * Only textures created from a file and not shared with another
+         * surface can be evicted.
+        */
+        bool Evict_Texture(cGL_Surface* obj);
+        // Return the texture memory of all managed surfaces in bytes
+        uint64_t Get_Texture_Memory(void) const;
+
+        /* Store a software image decoded in advance f.e. by a level loading thread
+         * The image gets used by Get_Surface() instead of loading the file again.
+         * path : the full image path as used by Get_Surface()
+         * Can be called from any thread.
+         * Returns false and deletes the image if one is already stored for the path.
+        */
+        bool Add_Preloaded_Image(const boost::filesystem::path& path, cVideo::cSoftware_Image software_image);
+        /* Remove the preloaded software image of the given path and return it
+         * Returns an empty software image if none is available.
+         * Can be called from any thread.
+        */
+        cVideo::cSoftware_Image Take_Preloaded_Image(const boost::filesystem::path& path);
+        /* Return true if a preloaded software image of the given path is available
+         * image : if set it must also be the stored image
+        */
+        bool Has_Preloaded_Image(const boost::filesystem::path& path, const sf::Image* image = NULL);
+        // Delete the preloaded software image of the given path if it is still the given image
+        void Delete_Preloaded_Image(const boost::filesystem::path& path, const sf::Image* image);
+        // Delete all not used preloaded software images
+        void Delete_Preloaded_Images(void);
+
         // highest opengl texture id found
         GLuint m_high_texture_id;
+        // current frame for the texture last use
+        uint32_t m_frame;
+
+        // frames between the texture budget checks
+        static const uint32_t m_budget_check_frames;
+        // frames a texture must not be drawn before it can be evicted
+        static const uint32_t m_evict_idle_frames;
 
     private:
+        // least recently drawn first
+        struct last_use_sort {
+            bool operator()(const cGL_Surface* a, const cGL_Surface* b) const
+            {
+                return a->m_last_use_frame < b->m_last_use_frame;
+            }
+        };
+
         // saved textures for reloading
         Saved_Texture_List m_saved_textures;
+
+        typedef std::map<boost::filesystem::path, cVideo::cSoftware_Image> Preloaded_Image_Map;
+        // software images waiting for their texture upload
+        Preloaded_Image_Map m_preloaded_images;
+        // guards m_preloaded_images
+        boost::mutex m_preloaded_mutex;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -30,6 +30,10 @@ namespace fs = boost::filesystem;
 
 namespace TSC {
 
+typedef std::map<std::pair<std::string, uint32_t>, cImageSet::Definition*> ImageSet_Definition_Map;
+// shared animation definitions keyed by the requested path and default time
+static ImageSet_Definition_Map g_image_set_definitions;
+
 /* *** *** *** *** *** *** *** cImageSet::FrameInfo *** *** *** *** *** *** *** *** *** *** */
 cImageSet::FrameInfo::FrameInfo()
 {
@@ -131,6 +135,9 @@ cImageSet::Surface::Surface(void)
 {
     m_image = NULL;
     m_time = 0;
+    m_time_min = 0;
+    m_time_max = 0;
+    m_branches = NULL;
 }
 
 cImageSet::Surface::~Surface(void)
@@ -141,17 +148,17 @@ cImageSet::Surface::~Surface(void)
 void cImageSet::Surface::Enter(void)
 {
     // set random time for this frame
-    m_time = m_info.m_time_min + rand() % (m_info.m_time_max - m_info.m_time_min + 1);
+    m_time = m_time_min + rand() % (m_time_max - m_time_min + 1);
 }
 
 int cImageSet::Surface::Leave(void)
 {
     // determine any branching to other frames
-    if(m_info.m_branches.size() == 0)
+    if(!m_branches || m_branches->empty())
         return -1;
 
     int rnd = (rand() % 100) + 1; // 1 to 100 inclusive
-    for(FrameInfo::List_Type::iterator it = m_info.m_branches.begin(); it != m_info.m_branches.end(); ++it)
+    for(FrameInfo::List_Type::const_iterator it = m_branches->begin(); it != m_branches->end(); ++it)
     {
         // first is frame number, second is percentage
         if(rnd <= it->second) {
@@ -197,8 +204,8 @@ void cImageSet::Add_Image(cGL_Surface* image, uint32_t time /* = 0 */)
     obj.m_time = time;
 
     // we may not be adding from an image set, so set up some initial information
-    obj.m_info.m_time_min = time;
-    obj.m_info.m_time_max = time;
+    obj.m_time_min = time;
+    obj.m_time_max = time;
 
     m_images.push_back(obj);
 }
@@ -225,32 +232,28 @@ bool cImageSet::Add_Image_Set(const std::string& name, boost::filesystem::path p
         }
     }
     else {
-        // Parse the animation file
-        filename = pPackage_Manager->Get_Pixmap_Reading_Path(path_to_utf8(path));
-        if(filename == boost::filesystem::path()) {
+        // Get the shared animation file
+        filename = path;
+        const Definition* definition = Get_Definition(path, time);
+        if(!definition) {
             cerr << "Warning: Unable to load image set: " << name << " " << Get_Identity() << endl;
             return false;
         }
 
-        Parser parser(time);
-        if(!parser.Parse(path_to_utf8(filename))) {
-            cerr << "Warning: Unable to parse image set: " << filename << endl;
-            return false;
-        }
-
-        if(parser.m_images.size() == 0) {
-            cerr << "Warning: Empty image set: " << filename << endl;
-            return false;
-        }
-
         // Add images
-        for(Parser::List_Type::iterator itr = parser.m_images.begin(); itr != parser.m_images.end(); ++itr) {
-            cGL_Surface* surface = pVideo->Get_Package_Surface(itr->m_filename);
+        m_images.reserve(m_images.size() + definition->m_frames.size());
+
+        for(unsigned int i = 0; i < definition->m_frames.size(); i++) {
+            cGL_Surface* surface = definition->m_images[i];
             if(surface) {
-                Add_Image(surface, itr->m_time_min);
+                const FrameInfo& info = definition->m_frames[i];
+                Add_Image(surface, info.m_time_min);
 
                 // update info
-                m_images.back().m_info = *itr;
+                Surface& obj = m_images.back();
+                obj.m_time_min = info.m_time_min;
+                obj.m_time_max = info.m_time_max;
+                obj.m_branches = &info.m_branches;
             }
         }
     }
@@ -401,8 +404,8 @@ void cImageSet::Set_Time_All(const uint32_t time, const bool default_time /* = 0
     for (Surface_List::iterator itr = m_images.begin(); itr != m_images.end(); ++itr) {
         Surface& obj = (*itr);
         obj.m_time = time;
-        obj.m_info.m_time_min = time;
-        obj.m_info.m_time_max = time;
+        obj.m_time_min = time;
+        obj.m_time_max = time;
     }
 
     if (default_time) {
@@ -410,6 +413,57 @@ void cImageSet::Set_Time_All(const uint32_t time, const bool default_time /* = 0
     }
 }
 
+/* static */
+const cImageSet::Definition* cImageSet::Get_Definition(const fs::path& path, uint32_t time /* = 0 */)
+{
+    std::pair<std::string, uint32_t> key(path_to_utf8(path), time);
+
+    // already loaded
+    ImageSet_Definition_Map::iterator it = g_image_set_definitions.find(key);
+    if(it != g_image_set_definitions.end()) {
+        return it->second;
+    }
+
+    fs::path filename = pPackage_Manager->Get_Pixmap_Reading_Path(key.first);
+    if(filename == fs::path()) {
+        return NULL;
+    }
+
+    Parser parser(time);
+    if(!parser.Parse(path_to_utf8(filename))) {
+        cerr << "Warning: Unable to parse image set: " << filename << endl;
+        return NULL;
+    }
+
+    if(parser.m_images.size() == 0) {
+        cerr << "Warning: Empty image set: " << filename << endl;
+        return NULL;
+    }
+
+    Definition* definition = new Definition();
+    definition->m_frames.swap(parser.m_images);
+    definition->m_images.reserve(definition->m_frames.size());
+
+    // resolve the frame images once
+    for(Parser::List_Type::const_iterator itr = definition->m_frames.begin(); itr != definition->m_frames.end(); ++itr) {
+        definition->m_images.push_back(pVideo->Get_Package_Surface(itr->m_filename));
+    }
+
+    g_image_set_definitions[key] = definition;
+
+    return definition;
+}
+
+/* static */
+void cImageSet::Clear_Definitions(void)
+{
+    for(ImageSet_Definition_Map::iterator it = g_image_set_definitions.begin(); it != g_image_set_definitions.end(); ++it) {
+        delete it->second;
+    }
+
+    g_image_set_definitions.clear();
+}
+
 /* static */
 cGL_Surface* cImageSet::Fetch_Single_Image(const fs::path& path, int idx /*= 0*/)
 {
@@ -73,10 +73,34 @@ namespace TSC {
             cGL_Surface* m_image;
             // time to display in milliseconds
             uint32_t m_time;
-            // information
-            FrameInfo m_info;
+            // random display time range
+            uint32_t m_time_min;
+            uint32_t m_time_max;
+            // branches shared with the animation definition or NULL
+            const FrameInfo::List_Type* m_branches;
         };
 
+        /* *** *** *** *** *** *** *** Definition *** *** *** *** *** *** *** *** *** *** */
+
+        /* Parsed animation file
+         * shared by every image set adding the same file and never modified after creation
+        */
+        struct Definition {
+            // parsed frames
+            Parser::List_Type m_frames;
+            // resolved frame images, NULL if not found
+            std::vector<cGL_Surface*> m_images;
+        };
+
+        /* Get the shared definition of the given animation file
+         * parses and caches it on first use, returns NULL if it could not be loaded
+        */
+        static const Definition* Get_Definition(const boost::filesystem::path& path, uint32_t time = 0);
+        /* Delete all cached definitions
+         * must be called when the package search path changes or the images get deleted
+        */
+        static void Clear_Definitions(void);
+
 
         /* *** *** *** *** *** *** *** cImageSet Contents *** *** *** *** *** *** *** *** *** *** */
 
@@ -252,6 +252,8 @@ cImage_Settings_Parser::~cImage_Settings_Parser(void)
 
 cImage_Settings_Data* cImage_Settings_Parser::Get(const boost::filesystem::path& filename, bool load_base_settings /* = 1 */)
 {
+    boost::mutex::scoped_lock lock(m_mutex);
+
     m_load_base = load_base_settings;
     m_settings_temp = new cImage_Settings_Data();
 
@@ -81,6 +81,7 @@ namespace TSC {
         /* Returns the settings from the given file
          * load_base_settings : if set will overwrite settings with all base settings if available
          * The returned settings data should be deleted if not used anymore
+         * Can be called from several threads at once.
         */
         cImage_Settings_Data* Get(const boost::filesystem::path& filename, bool load_base_settings = 1);
 
@@ -91,6 +92,10 @@ namespace TSC {
         cImage_Settings_Data* m_settings_temp;
         // load base settings
         bool m_load_base;
+
+    private:
+        // guards the temporary parsing state
+        boost::mutex m_mutex;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
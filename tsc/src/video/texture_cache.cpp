@@ -0,0 +1,296 @@
+/***************************************************************************
+ * texture_cache.cpp - decoded texture cache files
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/texture_cache.hpp"
+#include "../video/video.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/global_basic.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+namespace bip = boost::interprocess;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cTexture_Cache_File *** *** *** *** *** *** *** *** *** *** */
+
+// "TSCT"
+const uint32_t cTexture_Cache_File::m_file_magic = 0x54435354;
+const uint32_t cTexture_Cache_File::m_file_version = 2;
+
+cTexture_Cache_File::cTexture_Cache_File(void)
+{
+    m_header = NULL;
+}
+
+cTexture_Cache_File::~cTexture_Cache_File(void)
+{
+    //
+}
+
+bool cTexture_Cache_File::Open(const fs::path& filename)
+{
+    m_header = NULL;
+
+    try {
+        bip::file_mapping file(path_to_utf8(filename).c_str(), bip::read_only);
+        bip::mapped_region region(file, bip::read_only);
+
+        m_file.swap(file);
+        m_region.swap(region);
+    }
+    // not available
+    catch (const bip::interprocess_exception&) {
+        return 0;
+    }
+
+    if (m_region.get_size() < sizeof(cTexture_Cache_Header)) {
+        return 0;
+    }
+
+    const cTexture_Cache_Header* header = static_cast<const cTexture_Cache_Header*>(m_region.get_address());
+
+    if (header->m_magic != m_file_magic || header->m_version != m_file_version) {
+        return 0;
+    }
+
+    // incomplete file
+    const uint64_t pixels_size = static_cast<uint64_t>(header->m_texture_width) * header->m_texture_height * 4;
+
+    if (m_region.get_size() != sizeof(cTexture_Cache_Header) + header->m_path_length + pixels_size) {
+        return 0;
+    }
+
+    m_header = header;
+    return 1;
+}
+
+bool cTexture_Cache_File::Is_Current(const fs::path& settings_filename) const
+{
+    if (!m_header) {
+        return 0;
+    }
+
+    // created with other texture settings
+    if (m_header->m_max_texture_size != static_cast<uint32_t>(pVideo->m_max_texture_size) || m_header->m_low_texture_quality != (pVideo->m_texture_quality < 0.25f)) {
+        return 0;
+    }
+
+    // source files changed
+    return m_header->m_png_time == Get_File_Time(Get_Real_PNG_Path()) && m_header->m_settings_time == Get_Settings_Time(settings_filename);
+}
+
+const cTexture_Cache_Header* cTexture_Cache_File::Get_Header(void) const
+{
+    return m_header;
+}
+
+fs::path cTexture_Cache_File::Get_Real_PNG_Path(void) const
+{
+    if (!m_header) {
+        return fs::path();
+    }
+
+    const char* path = reinterpret_cast<const char*>(m_header + 1);
+    return utf8_to_path(std::string(path, m_header->m_path_length));
+}
+
+const unsigned char* cTexture_Cache_File::Get_Pixels(void) const
+{
+    if (!m_header) {
+        return NULL;
+    }
+
+    return reinterpret_cast<const unsigned char*>(m_header + 1) + m_header->m_path_length;
+}
+
+bool cTexture_Cache_File::Save(const fs::path& filename, cTexture_Cache_Header header, const fs::path& real_png_path, const fs::path& settings_filename, const unsigned char* pixels)
+{
+    const std::string path = path_to_utf8(real_png_path);
+
+    header.m_magic = m_file_magic;
+    header.m_version = m_file_version;
+    header.m_png_time = Get_File_Time(real_png_path);
+    header.m_settings_time = Get_Settings_Time(settings_filename);
+    header.m_path_length = path.length();
+
+    boost::system::error_code ec;
+    fs::create_directories(filename.parent_path(), ec);
+
+    // write to a temporary file first as an incomplete file could get mapped
+    fs::path temp_filename = filename;
+    temp_filename.replace_extension(".tmp");
+
+    {
+        fs::ofstream file(temp_filename, ios::out | ios::binary | ios::trunc);
+
+        if (!file) {
+            return 0;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(cTexture_Cache_Header));
+        file.write(path.c_str(), path.length());
+        file.write(reinterpret_cast<const char*>(pixels), static_cast<std::streamsize>(header.m_texture_width) * header.m_texture_height * 4);
+
+        if (!file) {
+            file.close();
+            fs::remove(temp_filename, ec);
+            return 0;
+        }
+    }
+
+    fs::rename(temp_filename, filename, ec);
+
+    return !ec;
+}
+
+uint64_t cTexture_Cache_File::Get_Settings_Time(fs::path settings_filename)
+{
+    uint64_t settings_time = 0;
+
+    // follow the base settings like cImage_Settings_Parser but not endlessly
+    for (unsigned int depth = 0; depth < 10 && !settings_filename.empty(); depth++) {
+        const uint64_t file_time = Get_File_Time(settings_filename);
+
+        if (!file_time) {
+            break;
+        }
+
+        // a base changed to an older time must also be noticed
+        settings_time = settings_time * 31 + file_time;
+
+        fs::ifstream file(settings_filename);
+        fs::path base_filename;
+        std::string line;
+
+        while (std::getline(file, line)) {
+            std::istringstream parts(line);
+            std::string command;
+            std::string base;
+            int with_settings = 0;
+
+            // "base <image> <with settings>"
+            if (parts >> command >> base >> with_settings && command == "base" && with_settings) {
+                base_filename = settings_filename.parent_path() / utf8_to_path(base);
+                base_filename.replace_extension(".settings");
+            }
+        }
+
+        settings_filename = base_filename;
+    }
+
+    return settings_time;
+}
+
+/* *** *** *** *** *** *** *** cTexture_Cache_Writer *** *** *** *** *** *** *** *** *** *** */
+
+cTexture_Cache_Writer::cTexture_Cache_Writer(void)
+{
+    m_writing = 0;
+    m_exit = 0;
+}
+
+cTexture_Cache_Writer::~cTexture_Cache_Writer(void)
+{
+    {
+        boost::mutex::scoped_lock lock(m_mutex);
+        m_exit = 1;
+    }
+
+    m_queue_condition.notify_all();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    // not started
+    for (Write_List::iterator itr = m_queue.begin(); itr != m_queue.end(); ++itr) {
+        delete *itr;
+    }
+}
+
+void cTexture_Cache_Writer::Queue(const fs::path& filename, cTexture_Cache_Header header, const fs::path& real_png_path, const fs::path& settings_filename, const unsigned char* pixels)
+{
+    cTexture_Cache_Write* write = new cTexture_Cache_Write();
+    write->m_filename = filename;
+    write->m_header = header;
+    write->m_header.m_max_texture_size = pVideo->m_max_texture_size;
+    write->m_header.m_low_texture_quality = pVideo->m_texture_quality < 0.25f;
+    write->m_real_png_path = real_png_path;
+    write->m_settings_filename = settings_filename;
+    write->m_pixels.assign(pixels, pixels + static_cast<size_t>(header.m_texture_width) * header.m_texture_height * 4);
+
+    {
+        boost::mutex::scoped_lock lock(m_mutex);
+        m_queue.push_back(write);
+    }
+
+    // start with the first file
+    if (!m_thread.joinable()) {
+        m_thread = boost::thread(&cTexture_Cache_Writer::Worker, this);
+    }
+
+    m_queue_condition.notify_one();
+}
+
+void cTexture_Cache_Writer::Flush(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (!m_queue.empty() || m_writing) {
+        m_done_condition.wait(lock);
+    }
+}
+
+void cTexture_Cache_Writer::Worker(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (1) {
+        // write all files before exiting
+        if (m_queue.empty()) {
+            if (m_exit) {
+                return;
+            }
+
+            m_queue_condition.wait(lock);
+            continue;
+        }
+
+        cTexture_Cache_Write* write = m_queue.front();
+        m_queue.pop_front();
+        m_writing = 1;
+        lock.unlock();
+
+        try {
+            cTexture_Cache_File::Save(write->m_filename, write->m_header, write->m_real_png_path, write->m_settings_filename, &write->m_pixels[0]);
+        }
+        // the cache is optional
+        catch (const std::exception& ex) {
+            cerr << "Warning : Could not write texture cache " << path_to_utf8(write->m_filename) << " : " << ex.what() << endl;
+        }
+
+        delete write;
+
+        lock.lock();
+        m_writing = 0;
+        m_done_condition.notify_all();
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,154 @@
+/***************************************************************************
+ * texture_cache.hpp - decoded texture cache files
+ *
+ * Copyright © 2016 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_TEXTURE_CACHE_HPP
+#define TSC_TEXTURE_CACHE_HPP
+
+#include "../core/global_basic.hpp"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cTexture_Cache_Header *** *** *** *** *** *** *** *** *** *** */
+
+    /* Header of a texture cache file
+     * It is followed by the real image path (UTF-8, m_path_length bytes)
+     * and the RGBA pixels of the texture (m_texture_width * m_texture_height * 4 bytes).
+     * All fields have a fixed size and the struct has no padding.
+    */
+    struct cTexture_Cache_Header {
+        uint32_t m_magic;
+        uint32_t m_version;
+        // modification time of the loaded image (0 if none)
+        uint64_t m_png_time;
+        // combined modification times of the settings file and its base settings files (0 if none)
+        uint64_t m_settings_time;
+        // conditions the texture was created with
+        uint32_t m_max_texture_size;
+        uint32_t m_low_texture_quality;
+        // cGL_Surface texture size
+        uint32_t m_texture_width;
+        uint32_t m_texture_height;
+        // cGL_Surface start size
+        uint32_t m_width;
+        uint32_t m_height;
+        // create mipmaps
+        uint32_t m_mipmap;
+        // length of the real image path
+        uint32_t m_path_length;
+    };
+
+    /* *** *** *** *** *** *** *** cTexture_Cache_File *** *** *** *** *** *** *** *** *** *** */
+
+    /* A memory mapped texture cache file
+     *
+     * The cache holds the final texture pixels after the conversion to a
+     * power of two size and all downscaling, so they can be uploaded with
+     * cVideo::Create_GL_Texture() without decoding the PNG again.
+    */
+    class cTexture_Cache_File {
+    public:
+        cTexture_Cache_File(void);
+        ~cTexture_Cache_File(void);
+
+        /* Map the given file and check if it is complete
+         * Returns false if the file is not available or invalid.
+        */
+        bool Open(const boost::filesystem::path& filename);
+        // Return true if the cached texture was created from the current source files
+        bool Is_Current(const boost::filesystem::path& settings_filename) const;
+
+        // Return the header or NULL if not opened
+        const cTexture_Cache_Header* Get_Header(void) const;
+        // Return the image file the texture was loaded from
+        boost::filesystem::path Get_Real_PNG_Path(void) const;
+        // Return the texture pixels
+        const unsigned char* Get_Pixels(void) const;
+
+        /* Write a texture cache file
+         * Only the size, mipmap and texture condition fields of the header need to be set.
+         * Can be called from any thread.
+        */
+        static bool Save(const boost::filesystem::path& filename, cTexture_Cache_Header header, const boost::filesystem::path& real_png_path, const boost::filesystem::path& settings_filename, const unsigned char* pixels);
+
+        /* Return the combined modification time of the given settings file
+         * and all the settings files it is based on or 0 if none exists
+        */
+        static uint64_t Get_Settings_Time(boost::filesystem::path settings_filename);
+
+        // file format identifier and version
+        static const uint32_t m_file_magic;
+        static const uint32_t m_file_version;
+
+    private:
+        boost::interprocess::file_mapping m_file;
+        boost::interprocess::mapped_region m_region;
+        const cTexture_Cache_Header* m_header;
+    };
+
+    /* *** *** *** *** *** *** *** cTexture_Cache_Writer *** *** *** *** *** *** *** *** *** *** */
+
+    /* Writes texture cache files in a background thread
+     * so loading a texture does not wait for the disk.
+    */
+    class cTexture_Cache_Writer {
+    public:
+        cTexture_Cache_Writer(void);
+        // Writes the queued files and stops the thread
+        ~cTexture_Cache_Writer(void);
+
+        /* Copy the pixels and write them with cTexture_Cache_File::Save() in the background
+         * The texture condition fields of the header are set from the current video settings.
+         * Main thread only.
+        */
+        void Queue(const boost::filesystem::path& filename, cTexture_Cache_Header header, const boost::filesystem::path& real_png_path, const boost::filesystem::path& settings_filename, const unsigned char* pixels);
+        // Wait until all queued files are written
+        void Flush(void);
+
+    private:
+        // Writer thread function
+        void Worker(void);
+
+        struct cTexture_Cache_Write {
+            boost::filesystem::path m_filename;
+            cTexture_Cache_Header m_header;
+            boost::filesystem::path m_real_png_path;
+            boost::filesystem::path m_settings_filename;
+            std::vector<unsigned char> m_pixels;
+        };
+
+        typedef std::list<cTexture_Cache_Write*> Write_List;
+        Write_List m_queue;
+
+        boost::thread m_thread;
+        // guards the queue
+        boost::mutex m_mutex;
+        // signals a new file or exit to the writer thread
+        boost::condition_variable m_queue_condition;
+        // signals written files to Flush()
+        boost::condition_variable m_done_condition;
+        // the writer thread is writing a file
+        bool m_writing;
+        // the writer thread should exit
+        bool m_exit;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -22,6 +22,8 @@
 #include "../video/font.hpp"
 #include "../core/game_core.hpp"
 #include "../video/img_settings.hpp"
+#include "../video/img_cache.hpp"
+#include "../video/texture_cache.hpp"
 #include "../input/mouse.hpp"
 #include "../video/renderer.hpp"
 #include "../core/main.hpp"
@@ -32,8 +34,14 @@
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/filesystem/package_manager.hpp"
 #include "../core/filesystem/relative.hpp"
+#include "../audio/audio.hpp"
 #include "../core/global_basic.hpp"
 
+#include <cstring>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 using namespace std;
 
 namespace fs = boost::filesystem;
@@ -67,12 +75,17 @@ cVideo::cVideo(void)
     m_render_thread = boost::thread();
 
     mp_cegui_renderer = NULL;
+    m_texture_cache_writer = new cTexture_Cache_Writer();
 
     m_initialised = 0;
 }
 
 cVideo::~cVideo(void)
 {
+    // finish writing the texture cache
+    delete m_texture_cache_writer;
+    m_texture_cache_writer = NULL;
+
     CEGUI::System::destroy();
     CEGUI::OpenGLRenderer::destroy(*mp_cegui_renderer);
     mp_cegui_renderer = NULL;
@@ -413,38 +426,34 @@ void cVideo::Init_Image_Cache(bool recreate /* = 0 */)
 {
     m_imgcache_dir = pResource_Manager->Get_User_Imgcache_Directory();
     fs::path imgcache_dir_active = m_imgcache_dir / utf8_to_path(int_to_string(pPreferences->m_video_screen_w) + "x" + int_to_string(pPreferences->m_video_screen_h));
+    // no decoded textures while the cache is built
+    m_texture_cache_dir.clear();
 
     // if cache is disabled
     if (!pPreferences->m_image_cache_enabled) {
         return;
     }
 
-    // if not the same game version
-    if (recreate || pPreferences->m_game_version != tsc_version) {
-        // delete all caches
-        if (Dir_Exists(m_imgcache_dir)) {
-            try {
-                fs::remove_all(m_imgcache_dir);
-            }
-            // could happen if a file is locked or we have no write rights
-            catch (const std::exception& ex) {
-                cerr << ex.what() << endl;
+    if (!Dir_Exists(imgcache_dir_active)) {
+        fs::create_directories(imgcache_dir_active / utf8_to_path(GAME_PIXMAPS_DIR));
+    }
 
-                Loading_Screen_Draw_Text(_("Caching Images failed : Could not remove old images"));
-                sleep(2);
-            }
-        }
+    // the decoded textures are checked against the image files but remove them if forced
+    if (recreate) {
+        m_texture_cache_writer->Flush();
 
-        fs::create_directories(m_imgcache_dir);
+        boost::system::error_code ec;
+        fs::remove_all(imgcache_dir_active / utf8_to_path("textures"), ec);
     }
 
-    // no cache available
-    if (!Dir_Exists(imgcache_dir_active)) {
-        fs::create_directories(imgcache_dir_active / utf8_to_path(GAME_PIXMAPS_DIR));
-    }
-    // cache available
-    else {
+    // only rebuild images changed since the last run unless forced
+    cImage_Cache_Builder builder(imgcache_dir_active, pResource_Manager->Get_Game_Pixmaps_Directory());
+
+    // cache is up to date
+    if (!builder.Prepare(recreate)) {
+        builder.Finish();
         m_imgcache_dir = imgcache_dir_active;
+        m_texture_cache_dir = imgcache_dir_active / utf8_to_path("textures");
         return;
     }
 
@@ -455,146 +464,24 @@ void cVideo::Init_Image_Cache(bool recreate /* = 0 */)
     // set loading screen text
     Loading_Screen_Draw_Text(_("Caching Images"));
 
-    // get all files
-    vector<fs::path> image_files = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory(), ".settings", true);
-
-    unsigned int loaded_files = 0;
-    unsigned int file_count = image_files.size();
-
-    // create directories, load images and save to cache
-    for (vector<fs::path>::iterator itr = image_files.begin(); itr != image_files.end(); ++itr) {
-        // get filenames
-        fs::path filename = (*itr);
-        fs::path cache_filename = imgcache_dir_active / fs_relative(pResource_Manager->Get_Game_Data_Directory(), filename);
-
-        // if directory
-        if (fs::is_directory(filename)) {
-            if (!fs::is_directory(cache_filename)) {
-                fs::create_directory(cache_filename);
-            }
-
-            loaded_files++;
-            continue;
-        }
-
-        bool settings_file = false;
-
-        // Don't use .settings file type directly for image loading
-        if (filename.extension() == fs::path(".settings")) {
-            settings_file = true;
-            filename.replace_extension(".png");
-        }
-
-        // load software image
-        cSoftware_Image software_image = Load_Image(filename);
-        sf::Image* p_sf_image = software_image.m_sf_image;
-        cImage_Settings_Data* settings = software_image.m_settings;
-
-        // failed to load image
-        if (!p_sf_image) {
-            continue;
-        }
-
-        /* don't cache if no image settings or images without the width and height set
-         * as there is currently no support to get the old and real image size
-         * and thus the scaled down (cached) image size is used which is wrong
-        */
-        if (!settings || !settings->m_width || !settings->m_height) {
-            if (settings) {
-                debug_print("Info : %s has no image settings image size set and will not get cached\n", cache_filename.c_str());
-            }
-            else {
-                debug_print("Info : %s has no image settings and will not get cached\n", cache_filename.c_str());
-            }
-            delete p_sf_image;
-            continue;
-        }
-
-        // create final image
-        p_sf_image = Convert_To_Final_Software_Image(p_sf_image);
-
-        // get final size for this resolution
-        cSize_Int size = settings->Get_Surface_Size(p_sf_image);
-        delete settings;
-        int new_width = size.m_width;
-        int new_height = size.m_height;
-
-        // apply maximum texture size
-        Apply_Max_Texture_Size(new_width, new_height);
-
-        // does not need to be downsampled
-        if (new_width >= p_sf_image->getSize().x && new_height >= p_sf_image->getSize().y) {
-            delete p_sf_image;
-            p_sf_image = NULL;
-            continue;
-        }
-
-        // calculate block reduction
-        int reduce_block_x = p_sf_image->getSize().x / new_width;
-        int reduce_block_y = p_sf_image->getSize().y / new_height;
-
-        // create downsampled image
-        /* Old SDL TSC queried SDL for a "bytes per pixels" value, see
-         * <https://wiki.libsdl.org/SDL_PixelFormat>.  This is simply
-         * the number of bytes required to store all info about one
-         * pixel.  It can easily be calculated without SDL: If yor
-         * image has a depth of 8 *bits* per colour, then a pixel
-         * consists of 3x8 = 24 bits (RGB) or 4x8 = 32 bits
-         * (RGBA). For 24 bits you need 3 bytes to store, for 32 bits
-         * 4 bytes. SFML guarantees in the documentation of
-         * sf::Image::getPixelPtr() that RGBA data is returned with a
-         * colour depth of 8 bit (resulting in 32 bits per pixel as
-         * per the above). If SFML ever supports other colour depths,
-         * the required bytes-per-pixel storage value can easily be
-         * calculated with:
-         *   ceil(bits-per-pixel * 4 / 8.0)
-         * Where 4
-         * stands for RGBA. For plain RGB you'd need to insert 3
-         * instead. For now, relying on SFML's docs, we just hardcode
-         * 4 bytes as that is what SFML returns to us. */
-        unsigned int image_bpp = 4; // 8 bits-per-color x 4 colors (RGBA) = 32 bits. 32 bits / 8 bits = 4 bytes.
-        unsigned char* image_downsampled = new unsigned char[new_width * new_height * image_bpp];
-        bool downsampled = Downscale_Image(static_cast<const unsigned char*>(p_sf_image->getPixelsPtr()), p_sf_image->getSize().x, p_sf_image->getSize().y, image_bpp, image_downsampled, reduce_block_x, reduce_block_y);
-
-        delete p_sf_image;
-
-        // if image is available
-        if (downsampled) {
-            // save as png
-            if (settings_file) {
-                cache_filename.replace_extension(".png");
-            }
-
-            // save image
-            Save_Surface(cache_filename, image_downsampled, new_width, new_height, image_bpp);
-        }
-
-        delete[] image_downsampled;
+    // images are loaded, downscaled and saved by the worker threads
+    builder.Start();
 
-        // count files
-        loaded_files++;
-
-        // draw
+    while (!builder.Is_Finished()) {
         // update progress
-        Loading_Screen_Set_Progress(static_cast<float>(loaded_files) / static_cast<float>(file_count));
+        Loading_Screen_Set_Progress(builder.Get_Progress());
+        Loading_Screen_Draw();
 
-// OLD #ifdef _DEBUG
-// OLD             // update filename
-// OLD             cGL_Surface* surface_filename = pFont->Render_Text(pFont->m_font_small, path_to_utf8(filename), white);
-// OLD             // draw filename
-// OLD             surface_filename->Blit(game_res_w * 0.2f, game_res_h * 0.8f, 0.1f);
-// OLD #endif
-            Loading_Screen_Draw();
-// OLD #ifdef _DEBUG
-// OLD             // delete
-// OLD             delete surface_filename;
-// OLD #endif
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(20));
     }
 
+    builder.Finish();
+
     // set back texture detail
     m_texture_quality = real_texture_detail;
     // set directory after surfaces got loaded from Load_GL_Surface()
     m_imgcache_dir = imgcache_dir_active;
+    m_texture_cache_dir = imgcache_dir_active / utf8_to_path("textures");
 }
 
 int cVideo::Test_Video(int width, int height, int bpp, int flags /* = 0 */) const
@@ -670,6 +557,9 @@ void cVideo::Render(bool threaded /* = 0 */)
 {
     Render_Finish();
 
+    // keep the textures in the memory budget
+    pImage_Manager->Update();
+
     if (threaded) {
         CEGUI::System::getSingleton().renderAllGUIContexts();
 
@@ -935,29 +825,105 @@ cGL_Surface* cVideo :: Load_GL_Surface_Helper(boost::filesystem::path filename,
         }
     }
 
+    // use the software image if it was already decoded in the background
+    cSoftware_Image software_image;
+    if (use_settings) {
+        software_image = pImage_Manager->Take_Preloaded_Image(filename);
+    }
+
+    // decoded texture cache
+    fs::path texture_cache_filename;
+    fs::path settings_filename = filename;
+    settings_filename.replace_extension(".settings");
+
+    if (use_settings) {
+        texture_cache_filename = Get_Texture_Cache_Filename(filename);
+    }
+
+    // final surface
+    cGL_Surface* image = NULL;
+
+    if (!texture_cache_filename.empty()) {
+        cTexture_Cache_File cache_file;
+
+        // up to date texture available
+        if (cache_file.Open(texture_cache_filename) && cache_file.Is_Current(settings_filename)) {
+            const cTexture_Cache_Header* header = cache_file.Get_Header();
+
+            image = Create_Texture_From_Pixels(cache_file.Get_Pixels(), header->m_texture_width, header->m_texture_height, header->m_width, header->m_height, header->m_mipmap != 0);
+
+            if (image) {
+                // the settings are still needed for everything except the size
+                if (software_image.m_settings) {
+                    software_image.m_settings->Apply(image);
+                }
+                else if (File_Exists(settings_filename)) {
+                    cImage_Settings_Data* settings = pSettingsParser->Get(settings_filename);
+                    settings->Apply(image);
+                    delete settings;
+                }
+
+                // decoded in the background before the cache was written
+                delete software_image.m_sf_image;
+                delete software_image.m_settings;
+
+                image->m_path = filename;
+                image->m_real_png_path = cache_file.Get_Real_PNG_Path();
+                return image;
+            }
+        }
+    }
+
     // load software image
-    cSoftware_Image software_image = Load_Image_Helper(filename, use_settings, print_errors, package);
+    if (!software_image.m_sf_image) {
+        software_image = Load_Image_Helper(filename, use_settings, print_errors, package);
+    }
     sf::Image* p_sf_image = software_image.m_sf_image;
     cImage_Settings_Data* settings = software_image.m_settings;
 
-    // final surface
-    cGL_Surface* image = NULL;
+    if (p_sf_image) {
+        unsigned int force_width = 0;
+        unsigned int force_height = 0;
+        bool mipmap = 0;
+
+        // with settings
+        if (settings) {
+            // get the size
+            cSize_Int size = settings->Get_Surface_Size(p_sf_image);
+            Apply_Max_Texture_Size(size.m_width, size.m_height);
+
+            force_width = size.m_width;
+            force_height = size.m_height;
+            mipmap = settings->m_mipmap;
+        }
+
+        int width, height, texture_width, texture_height;
+        p_sf_image = Scale_Texture_Image(p_sf_image, force_width, force_height, width, height, texture_width, texture_height);
+
+        // save the final pixels for the next start in the background
+        if (!texture_cache_filename.empty()) {
+            cTexture_Cache_Header header;
+            header.m_texture_width = texture_width;
+            header.m_texture_height = texture_height;
+            header.m_width = width;
+            header.m_height = height;
+            header.m_mipmap = mipmap;
+
+            m_texture_cache_writer->Queue(texture_cache_filename, header, software_image.m_real_png_path, settings ? settings_filename : fs::path(), static_cast<const unsigned char*>(p_sf_image->getPixelsPtr()));
+        }
+
+        image = Create_Texture_From_Pixels(p_sf_image->getPixelsPtr(), texture_width, texture_height, width, height, mipmap);
+        delete p_sf_image;
+    }
 
-    // with settings
+    // apply settings
     if (settings) {
-        // get the size
-        cSize_Int size = settings->Get_Surface_Size(p_sf_image);
-        Apply_Max_Texture_Size(size.m_width, size.m_height);
-        // get basic settings surface
-        image = pVideo->Create_Texture(p_sf_image, settings->m_mipmap, size.m_width, size.m_height);
-        // apply settings
-        settings->Apply(image);
+        if (image) {
+            settings->Apply(image);
+        }
+
         delete settings;
     }
-    // without settings
-    else {
-        image = Create_Texture(p_sf_image);
-    }
     // set filenames
     if (image) {
         image->m_path = filename;
@@ -971,6 +937,26 @@ cGL_Surface* cVideo :: Load_GL_Surface_Helper(boost::filesystem::path filename,
     return image;
 }
 
+fs::path cVideo::Get_Texture_Cache_Filename(const fs::path& filename) const
+{
+    // disabled
+    if (m_texture_cache_dir.empty()) {
+        return fs::path();
+    }
+
+    // only images in the game data directory as in Load_Image_Helper()
+    fs::path rel = fs_relative(pResource_Manager->Get_Game_Data_Directory(), filename);
+
+    if (rel.begin() == rel.end() || *(rel.begin()) == fs::path("..")) {
+        return fs::path();
+    }
+
+    fs::path cache_filename = m_texture_cache_dir / rel;
+    cache_filename.replace_extension(".rgba");
+
+    return cache_filename;
+}
+
 /**
  * OpenGL only understands textures whose edges each have a length
  * that is a power of 2. This function ensures that our images fulfill
@@ -1007,32 +993,23 @@ cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */
         return NULL;
     }
 
-    // create final image
-    p_sf_image = Convert_To_Final_Software_Image(p_sf_image);
+    int width, height, texture_width, texture_height;
+    p_sf_image = Scale_Texture_Image(p_sf_image, force_width, force_height, width, height, texture_width, texture_height);
 
-    /* todo : Make this a render request because it forces an early thread render finish as opengl commands are used directly.
-     * Reduces performance if the render thread is on. It's usually called from the text rendering in cTimeDisplay::Update.
-    */
-    pVideo->Render_Finish();
+    cGL_Surface* image = Create_Texture_From_Pixels(p_sf_image->getPixelsPtr(), texture_width, texture_height, width, height, mipmap);
 
-    // create one texture
-    GLuint image_num = 0;
-    glGenTextures(1, &image_num);
+    delete p_sf_image;
 
-    // if image id is 0 it failed
-    if (!image_num) {
-        cerr << "Error : GL image generation failed" << endl;
-        delete p_sf_image;
-        return NULL;
-    }
+    return image;
+}
 
-    // set highest texture id
-    if (pImage_Manager->m_high_texture_id < image_num) {
-        pImage_Manager->m_high_texture_id = image_num;
-    }
+sf::Image* cVideo::Scale_Texture_Image(sf::Image* p_sf_image, unsigned int force_width, unsigned int force_height, int& width, int& height, int& texture_width, int& texture_height) const
+{
+    // create final image
+    p_sf_image = Convert_To_Final_Software_Image(p_sf_image);
 
-    int width = p_sf_image->getSize().x;
-    int height = p_sf_image->getSize().y;
+    width = p_sf_image->getSize().x;
+    height = p_sf_image->getSize().y;
 
     // forced size is set
     if (force_width > 0 && force_height > 0) {
@@ -1048,8 +1025,8 @@ cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */
     }
 
     // texture size
-    int texture_width = width;
-    int texture_height = height;
+    texture_width = width;
+    texture_height = height;
     // check if the image size is greater than the maximum texture size
     Apply_Max_Texture_Size(texture_width, texture_height);
 
@@ -1060,7 +1037,7 @@ cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */
 
         // create scaled image
         unsigned char* new_pixels = static_cast<unsigned char*>(malloc(texture_width * texture_height * 4));
-        Downscale_Image(static_cast<const unsigned char*>(p_sf_image->getPixelsPtr()), p_sf_image->getSize().x, p_sf_image->getSize().y, 8 /* getPixelsPtr() guarantees 8 BPP */, new_pixels, reduce_block_x, reduce_block_y);
+        Downscale_Image(static_cast<const unsigned char*>(p_sf_image->getPixelsPtr()), p_sf_image->getSize().x, p_sf_image->getSize().y, 4 /* getPixelsPtr() guarantees RGBA with 8 bits per channel */, new_pixels, reduce_block_x, reduce_block_y);
 
         sf::Image* p_new_image = new sf::Image();
         p_new_image->create(texture_width, texture_height, static_cast<const uint8_t*>(new_pixels));
@@ -1071,6 +1048,31 @@ cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */
         free(new_pixels);
     }
 
+    return p_sf_image;
+}
+
+cGL_Surface* cVideo::Create_Texture_From_Pixels(const void* pixels, int texture_width, int texture_height, int width, int height, bool mipmap /* = 0 */) const
+{
+    /* todo : Make this a render request because it forces an early thread render finish as opengl commands are used directly.
+     * Reduces performance if the render thread is on. It's usually called from the text rendering in cTimeDisplay::Update.
+    */
+    pVideo->Render_Finish();
+
+    // create one texture
+    GLuint image_num = 0;
+    glGenTextures(1, &image_num);
+
+    // if image id is 0 it failed
+    if (!image_num) {
+        cerr << "Error : GL image generation failed" << endl;
+        return NULL;
+    }
+
+    // set highest texture id
+    if (pImage_Manager->m_high_texture_id < image_num) {
+        pImage_Manager->m_high_texture_id = image_num;
+    }
+
     // use the generated texture
     glBindTexture(GL_TEXTURE_2D, image_num);
 
@@ -1080,12 +1082,7 @@ cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */
     // set texture magnification function
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     // upload to OpenGL texture
-    Create_GL_Texture(texture_width, texture_height, p_sf_image->getPixelsPtr(), mipmap);
-
-    // unset pixel store mode
-    // OLD (see corresponding call further above) glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-
-    delete p_sf_image;
+    Create_GL_Texture(texture_width, texture_height, pixels, mipmap);
 
     // create OpenGL surface class
     cGL_Surface* image = new cGL_Surface();
@@ -1370,6 +1367,124 @@ void cVideo::Apply_Max_Texture_Size(int& width, int& height) const
     }
 }
 
+/* Downscale an RGBA image where the blocks fit exactly into the image
+ * All 4 channels of a pixel are summed at once. Gives the same result
+ * as the generic code in Downscale_Image().
+*/
+static void Downscale_Image_RGBA(const unsigned char* const orig, int width, unsigned char* resampled, int mip_width, int mip_height, int block_size_x, int block_size_y)
+{
+    const int row_size = width * 4;
+    const int block_area = block_size_x * block_size_y;
+
+    for (int j = 0; j < mip_height; ++j) {
+        unsigned char* dest = resampled + j * mip_width * 4;
+
+        for (int i = 0; i < mip_width; ++i) {
+            const unsigned char* src = orig + (j * block_size_y) * row_size + (i * block_size_x) * 4;
+            // start the sum at the rounding value
+            unsigned int sum_r = block_area >> 1;
+            unsigned int sum_g = sum_r;
+            unsigned int sum_b = sum_r;
+            unsigned int sum_a = sum_r;
+
+            for (int v = 0; v < block_size_y; ++v) {
+                const unsigned char* pixel = src + v * row_size;
+
+                for (int u = 0; u < block_size_x; ++u) {
+                    sum_r += pixel[0];
+                    sum_g += pixel[1];
+                    sum_b += pixel[2];
+                    sum_a += pixel[3];
+                    pixel += 4;
+                }
+            }
+
+            dest[0] = sum_r / block_area;
+            dest[1] = sum_g / block_area;
+            dest[2] = sum_b / block_area;
+            dest[3] = sum_a / block_area;
+            dest += 4;
+        }
+    }
+}
+
+#ifdef __SSE2__
+/* Downscale an RGBA image by 2x2 blocks with SSE2
+ * (sum + 2) >> 2 is the same as the rounded division in Downscale_Image_RGBA()
+*/
+static void Downscale_Image_RGBA_2x2_SSE2(const unsigned char* const orig, int width, unsigned char* resampled, int mip_width, int mip_height)
+{
+    const int row_size = width * 4;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rounding = _mm_set1_epi16(2);
+
+    for (int j = 0; j < mip_height; ++j) {
+        const unsigned char* row_1 = orig + (j * 2) * row_size;
+        const unsigned char* row_2 = row_1 + row_size;
+        unsigned char* dest = resampled + j * mip_width * 4;
+        int i = 0;
+
+        // 4 result pixels from 8x2 source pixels
+        for (; i + 4 <= mip_width; i += 4) {
+            __m128i sum[2];
+
+            for (int k = 0; k < 2; ++k) {
+                const __m128i top = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row_1 + (i + k * 2) * 8));
+                const __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row_2 + (i + k * 2) * 8));
+                // vertical sums of the pixels 0-1 and 2-3 as 16 bit values
+                const __m128i sum_lo = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+                const __m128i sum_hi = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+                // horizontal sums of the pixels 0+1 and 2+3
+                sum[k] = _mm_add_epi16(_mm_unpacklo_epi64(sum_lo, sum_hi), _mm_unpackhi_epi64(sum_lo, sum_hi));
+                sum[k] = _mm_srli_epi16(_mm_add_epi16(sum[k], rounding), 2);
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * 4), _mm_packus_epi16(sum[0], sum[1]));
+        }
+
+        // remaining pixels
+        if (i < mip_width) {
+            Downscale_Image_RGBA(orig + (j * 2) * row_size + i * 8, width, dest + i * 4, mip_width - i, 1, 2, 2);
+        }
+    }
+}
+
+/* Downscale an RGBA image by 4x4 blocks with SSE2
+ * (sum + 8) >> 4 is the same as the rounded division in Downscale_Image_RGBA()
+*/
+static void Downscale_Image_RGBA_4x4_SSE2(const unsigned char* const orig, int width, unsigned char* resampled, int mip_width, int mip_height)
+{
+    const int row_size = width * 4;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rounding = _mm_set1_epi16(8);
+
+    for (int j = 0; j < mip_height; ++j) {
+        const unsigned char* src = orig + (j * 4) * row_size;
+        unsigned char* dest = resampled + j * mip_width * 4;
+
+        for (int i = 0; i < mip_width; ++i) {
+            __m128i sum_lo = zero;
+            __m128i sum_hi = zero;
+
+            // vertical sums of the 4 pixels of each row as 16 bit values
+            for (int v = 0; v < 4; ++v) {
+                const __m128i row = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + v * row_size + i * 16));
+                sum_lo = _mm_add_epi16(sum_lo, _mm_unpacklo_epi8(row, zero));
+                sum_hi = _mm_add_epi16(sum_hi, _mm_unpackhi_epi8(row, zero));
+            }
+
+            // horizontal sum of the 4 pixels in the low 64 bits
+            __m128i sum = _mm_add_epi16(sum_lo, sum_hi);
+            sum = _mm_add_epi16(sum, _mm_srli_si128(sum, 8));
+            sum = _mm_srli_epi16(_mm_add_epi16(sum, rounding), 4);
+
+            const int pixel = _mm_cvtsi128_si32(_mm_packus_epi16(sum, zero));
+            memcpy(dest + i * 4, &pixel, 4);
+        }
+    }
+}
+#endif
+
 /* function from Jonathan Dummer
  * from image helper functions
  * MIT license
@@ -1393,6 +1508,22 @@ bool cVideo::Downscale_Image(const unsigned char* const orig, int width, int hei
         mip_height = 1;
     }
 
+    // fast path for RGBA images where the blocks fit exactly which is always the case for power of two sizes
+    if (channels == 4 && width % block_size_x == 0 && height % block_size_y == 0) {
+#ifdef __SSE2__
+        if (block_size_x == 2 && block_size_y == 2) {
+            Downscale_Image_RGBA_2x2_SSE2(orig, width, resampled, mip_width, mip_height);
+            return 1;
+        }
+        if (block_size_x == 4 && block_size_y == 4) {
+            Downscale_Image_RGBA_4x4_SSE2(orig, width, resampled, mip_width, mip_height);
+            return 1;
+        }
+#endif
+        Downscale_Image_RGBA(orig, width, resampled, mip_width, mip_height, block_size_x, block_size_y);
+        return 1;
+    }
+
     int j, i, c;
 
     for (j = 0; j < mip_height; ++j) {
@@ -1570,6 +1701,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
 
             pVideo->Render();
 
+            pAudio->Update();
             pFramerate->Update();
             // maximum fps
             Correct_Frame_Time(100);
@@ -1650,6 +1782,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
 
             pVideo->Render();
 
+            pAudio->Update();
             pFramerate->Update();
             // maximum fps
             Correct_Frame_Time(100);
@@ -1715,6 +1848,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
             pRenderer->Add(rect_request);
 
             pVideo->Render();
+            pAudio->Update();
             pFramerate->Update();
         }
 
@@ -1763,6 +1897,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
             }
 
             pVideo->Render();
+            pAudio->Update();
             pFramerate->Update();
         }
         break;
@@ -1852,6 +1987,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
             }
 
             pVideo->Render();
+            pAudio->Update();
             pFramerate->Update();
             // correction needed
             Correct_Frame_Time(speedfactor_fps * 2);
@@ -1945,6 +2081,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
             pRenderer->Add(request);
 
             pVideo->Render();
+            pAudio->Update();
             pFramerate->Update();
             // correction needed
             Correct_Frame_Time(speedfactor_fps * 2);
@@ -1985,6 +2122,7 @@ void Draw_Effect_In(Effect_Fadein effect /* = EFFECT_IN_RANDOM */, float speed /
 
             pVideo->Render();
 
+            pAudio->Update();
             pFramerate->Update();
             // maximum fps
             Correct_Frame_Time(100);
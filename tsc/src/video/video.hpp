@@ -63,7 +63,7 @@ namespace TSC {
         */
         void Init_Video(bool reload_textures_from_file = 0, bool use_preferences = 1);
 
-        /* Initialize the image cache and recreates cache if game version changed
+        /* Initialize the image cache and rebuild the images changed since the last run
          * recreate : if set force cache recreation
          * Sets the CEGUI root window to the loading screen. If you own a CEGUI
          * root window, destroy it before calling this function.
@@ -152,6 +152,22 @@ namespace TSC {
         */
         cGL_Surface* Create_Texture(sf::Image* p_sf_image, bool mipmap = 0, unsigned int force_width = 0, unsigned int force_height = 0) const;
 
+        /* Convert and downscale an SFML image to the final texture image
+         * p_sf_image is freed if a new image is returned.
+         * width/height : returns the surface start size
+         * texture_width/height : returns the texture size
+        */
+        sf::Image* Scale_Texture_Image(sf::Image* p_sf_image, unsigned int force_width, unsigned int force_height, int& width, int& height, int& texture_width, int& texture_height) const;
+
+        /* Create a GL image from final texture pixels
+         * pixels : RGBA pixels with the texture size
+         * width/height : the surface start size
+        */
+        cGL_Surface* Create_Texture_From_Pixels(const void* pixels, int texture_width, int texture_height, int width, int height, bool mipmap = 0) const;
+
+        // Return the decoded texture cache file for the given image or an empty path if it can not be cached
+        boost::filesystem::path Get_Texture_Cache_Filename(const boost::filesystem::path& filename) const;
+
         /* Copy pixels to the bound GL texture
          * mipmap : create texture mipmaps
         */
@@ -218,6 +234,10 @@ namespace TSC {
 
         // active image cache directory
         boost::filesystem::path m_imgcache_dir;
+        // decoded texture cache directory, empty if disabled
+        boost::filesystem::path m_texture_cache_dir;
+        // writes the decoded texture cache files
+        cTexture_Cache_Writer* m_texture_cache_writer;
 
         // geometry quality level 0.0 - 1.0
         float m_geometry_quality;